@@ -401,6 +401,29 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the primitive attributes huge pages mode.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output huge pages mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_huge_pages_mode(
+        const_dnnl_primitive_attr_t attr, dnnl_huge_pages_mode_t *mode);
+
+/// Sets primitive attributes huge pages mode. The mode controls the page
+/// size backing the library-managed scratchpad of the primitive.
+///
+/// @param attr Primitive attributes.
+/// @param mode Huge pages mode. The possible values are:
+///     #dnnl_huge_pages_mode_any (default),
+///     #dnnl_huge_pages_mode_none,
+///     #dnnl_huge_pages_mode_transparent, and
+///     #dnnl_huge_pages_mode_hugetlb.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_huge_pages_mode(
+        dnnl_primitive_attr_t attr, dnnl_huge_pages_mode_t mode);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -3525,6 +3548,33 @@ dnnl_status_t DNNL_API dnnl_matmul_primitive_desc_create(
         const_dnnl_memory_desc_t bias_desc, const_dnnl_memory_desc_t dst_desc,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a grouped matrix multiplication
+/// primitive.
+///
+/// The rows of the source and destination matrices are split into G
+/// consecutive groups, and the rows of group g are multiplied by the g-th
+/// slice of the stacked weights:
+///     dst[off[g]:off[g + 1], :] = src[off[g]:off[g + 1], :] * wei[g, :, :],
+/// where off is the group offsets tensor passed as #DNNL_ARG_GROUP_OFFSETS at
+/// execution time.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor of shape (M, K).
+/// @param weights_desc Weights memory descriptor of shape (G, K, N).
+/// @param group_offsets_desc Group offsets memory descriptor of shape
+///     (G + 1) and #dnnl_s32 data type.
+/// @param dst_desc Destination memory descriptor of shape (M, N).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t group_offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_matmul
 
 /// @addtogroup dnnl_api_resampling Resampling
@@ -3642,6 +3692,74 @@ dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool
+/// @{
+
+/// Returns the statistics of the scratchpad pool of a stream.
+///
+/// The pool is used when the library is run with `ONEDNN_SCRATCHPAD_POOL=1`.
+/// Primitives in #dnnl_scratchpad_mode_library mode then take their
+/// scratchpad from the pool of the stream they are executed on instead of
+/// holding a scratchpad of their own.
+///
+/// @param stream Execution stream.
+/// @param stats Output scratchpad pool statistics.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_scratchpad_pool_stats(
+        const_dnnl_stream_t stream, dnnl_scratchpad_pool_stats_t *stats);
+
+/// Sets the maximum number of bytes the scratchpad pool of a stream keeps
+/// allocated. Buffers returned to the pool above the limit are released, so
+/// the limit may only be exceeded by the buffers in use.
+///
+/// @param stream Execution stream.
+/// @param limit Scratchpad pool limit in bytes. 0 stands for no limit.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_scratchpad_pool_limit(
+        dnnl_stream_t stream, size_t limit);
+
+/// @} dnnl_api_scratchpad_pool
+
+/// @addtogroup dnnl_api_cpu_affinity
+/// @{
+
+/// Sets the CPU affinity of a stream.
+///
+/// While a primitive is executed on the stream, the calling thread is
+/// restricted to the given cores and the threads of the library parallel
+/// regions are pinned to them in a round-robin manner. The number of threads
+/// is not changed, so it is recommended to set it to @p ncores by the means
+/// of the threading runtime. The affinity is supported on Linux only.
+///
+/// The OpenMP and TBB worker threads stay pinned after the execution until a
+/// parallel region runs without a stream affinity. The affinity may be changed
+/// while primitives execute on the stream, in which case the executions
+/// already started keep the previous one.
+///
+/// @param stream CPU stream of a native CPU engine.
+/// @param ncores Number of cores. 0 resets the affinity of the stream.
+/// @param cores Array of @p ncores core ids available to the process.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_cpu_affinity(
+        dnnl_stream_t stream, int ncores, const int *cores);
+
+/// Returns the CPU affinity of a stream.
+///
+/// @param stream Execution stream.
+/// @param ncores Input: size of the @p cores array. Output: number of cores
+///     in the affinity of the stream, 0 if it has none.
+/// @param cores Output array of core ids. May be NULL to query the number of
+///     cores only.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_cpu_affinity(
+        const_dnnl_stream_t stream, int *ncores, int *cores);
+
+/// @} dnnl_api_cpu_affinity
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -302,6 +302,30 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Huge pages mode
+enum class huge_pages_mode {
+    /// The library backs large internal buffers according to the
+    /// `ONEDNN_HUGE_PAGES` environment variable (default).
+    any = dnnl_huge_pages_mode_any,
+    /// Large internal buffers are backed by regular pages.
+    none = dnnl_huge_pages_mode_none,
+    /// Large internal buffers are aligned to the transparent huge page size
+    /// and marked as eligible for transparent huge pages.
+    transparent = dnnl_huge_pages_mode_transparent,
+    /// Large internal buffers are allocated from the pool of explicitly
+    /// reserved huge pages. If the pool is exhausted the library falls back
+    /// to transparent huge pages.
+    hugetlb = dnnl_huge_pages_mode_hugetlb,
+};
+
+/// Converts a huge pages mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API huge pages mode enum value.
+/// @returns Corresponding C API huge pages mode enum value.
+inline dnnl_huge_pages_mode_t convert_to_c(huge_pages_mode mode) {
+    return static_cast<dnnl_huge_pages_mode_t>(mode);
+}
+
 /// Rounding mode
 enum class rounding_mode {
     /// rounding mode dictated by the floating-point environment
@@ -4057,6 +4081,24 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the huge pages mode.
+    huge_pages_mode get_huge_pages_mode() const {
+        dnnl_huge_pages_mode_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_huge_pages_mode(get(), &result),
+                "could not get huge pages mode primitive attribute");
+        return huge_pages_mode(result);
+    }
+
+    /// Sets huge pages mode.
+    ///
+    /// @param mode Specified huge pages mode.
+    void set_huge_pages_mode(huge_pages_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_huge_pages_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set huge pages mode primitive attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -12858,6 +12900,81 @@ struct matmul : public primitive {
         : primitive(pd, cache_blob) {}
 };
 
+/// Grouped matrix multiplication (grouped matmul) primitive.
+///
+/// Multiplies consecutive row groups of the source matrix by the
+/// corresponding slices of the stacked weights in a single call, e.g. the
+/// tokens routed to the experts of a Mixture-of-Experts layer.
+struct grouped_matmul : public primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source of shape (M, K).
+        /// @param weights_desc Memory descriptor for weights of shape
+        ///     (G, K, N).
+        /// @param group_offsets_desc Memory descriptor for group offsets of
+        ///     shape (G + 1).
+        /// @param dst_desc Memory descriptor for destination of shape (M, N).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &group_offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_grouped_matmul_primitive_desc_create(
+                    &pd, aengine.get(), src_desc.get(), weights_desc.get(),
+                    group_offsets_desc.get(), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the grouped matmul primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a grouped matmul
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::matmul) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const {
+            return query_md(query::weights_md, 0);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul() = default;
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd) : primitive(pd) {}
+};
+
 /// @} dnnl_api_matmul
 
 /// @addtogroup dnnl_api_resampling Resampling
@@ -13923,6 +14040,69 @@ inline void set_primitive_cache_capacity(int capacity) {
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool Scratchpad Pool
+///
+/// A set of functions that provide control over the scratchpad pool of a
+/// stream.
+///
+/// @{
+
+/// Scratchpad pool statistics.
+using scratchpad_pool_stats = dnnl_scratchpad_pool_stats_t;
+
+/// @copydoc dnnl_stream_get_scratchpad_pool_stats()
+inline scratchpad_pool_stats get_scratchpad_pool_stats(const stream &astream) {
+    scratchpad_pool_stats result {};
+    error::wrap_c_api(
+            dnnl_stream_get_scratchpad_pool_stats(astream.get(), &result),
+            "could not get scratchpad pool statistics");
+    return result;
+}
+
+/// @copydoc dnnl_stream_set_scratchpad_pool_limit()
+inline void set_scratchpad_pool_limit(stream &astream, size_t limit) {
+    error::wrap_c_api(
+            dnnl_stream_set_scratchpad_pool_limit(astream.get(), limit),
+            "could not set scratchpad pool limit");
+}
+
+/// @} dnnl_api_scratchpad_pool
+
+/// @addtogroup dnnl_api_cpu_affinity CPU Affinity
+///
+/// A set of functions that control the cores the library threads use when
+/// executing primitives on a stream.
+///
+/// @{
+
+/// @copydoc dnnl_stream_set_cpu_affinity()
+/// @param astream CPU stream of a native CPU engine.
+/// @param cores Core ids available to the process. An empty vector resets the
+///     affinity of the stream.
+inline void set_cpu_affinity(stream &astream, const std::vector<int> &cores) {
+    error::wrap_c_api(dnnl_stream_set_cpu_affinity(astream.get(),
+                              (int)cores.size(), cores.data()),
+            "could not set cpu affinity");
+}
+
+/// Returns the CPU affinity of a stream.
+/// @param astream Execution stream.
+/// @returns Core ids of the affinity, empty if the stream has none.
+inline std::vector<int> get_cpu_affinity(const stream &astream) {
+    int ncores = 0;
+    error::wrap_c_api(
+            dnnl_stream_get_cpu_affinity(astream.get(), &ncores, nullptr),
+            "could not get cpu affinity");
+    std::vector<int> cores(ncores);
+    if (ncores > 0)
+        error::wrap_c_api(dnnl_stream_get_cpu_affinity(
+                                  astream.get(), &ncores, cores.data()),
+                "could not get cpu affinity");
+    return cores;
+}
+
+/// @} dnnl_api_cpu_affinity
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -2400,6 +2400,38 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Huge pages mode
+typedef enum {
+    /// The library backs large internal buffers according to the
+    /// `ONEDNN_HUGE_PAGES` environment variable (default).
+    dnnl_huge_pages_mode_any,
+    /// Large internal buffers are backed by regular pages.
+    dnnl_huge_pages_mode_none,
+    /// Large internal buffers are aligned to the transparent huge page size
+    /// and marked as eligible for transparent huge pages.
+    dnnl_huge_pages_mode_transparent,
+    /// Large internal buffers are allocated from the pool of explicitly
+    /// reserved huge pages. If the pool is exhausted the library falls back
+    /// to transparent huge pages.
+    dnnl_huge_pages_mode_hugetlb,
+} dnnl_huge_pages_mode_t;
+
+/// Statistics of the scratchpad pool of a stream
+typedef struct {
+    /// Number of bytes held by the pool, both in use and cached.
+    size_t capacity;
+    /// Number of bytes currently used by executing primitives.
+    size_t in_use;
+    /// Maximum number of bytes used at the same time.
+    size_t peak_in_use;
+    /// Maximum number of bytes the pool keeps cached, 0 if unlimited.
+    size_t limit;
+    /// Number of requests served with a cached buffer.
+    size_t hits;
+    /// Number of requests that required a new allocation.
+    size_t misses;
+} dnnl_scratchpad_pool_stats_t;
+
 /// Rounding mode
 typedef enum {
     /// rounding mode dictated by the floating-point environment
@@ -2562,6 +2594,8 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_SCALE 51
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_SHIFT 52
+/// Group offsets argument of the grouped matmul primitive.
+#define DNNL_ARG_GROUP_OFFSETS 53
 
 /// Workspace tensor argument. Workspace is used to pass information
 /// from forward propagation to backward propagation computations.
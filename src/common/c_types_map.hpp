@@ -204,6 +204,16 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using huge_pages_mode_t = dnnl_huge_pages_mode_t;
+namespace huge_pages_mode {
+const huge_pages_mode_t any = dnnl_huge_pages_mode_any;
+const huge_pages_mode_t none = dnnl_huge_pages_mode_none;
+const huge_pages_mode_t transparent = dnnl_huge_pages_mode_transparent;
+const huge_pages_mode_t hugetlb = dnnl_huge_pages_mode_hugetlb;
+} // namespace huge_pages_mode
+
+using scratchpad_pool_stats_t = dnnl_scratchpad_pool_stats_t;
+
 using rounding_mode_t = dnnl_rounding_mode_t;
 namespace rounding_mode {
 const rounding_mode_t environment = dnnl_rounding_mode_environment;
@@ -188,6 +188,12 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
         return get_size_no_lock();
     }
 
+    // Removes the entry associated with the key, if any.
+    void remove(const key_t &key) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        cache_mapper().erase(key);
+    }
+
 protected:
     int get_size_no_lock() const { return (int)cache_mapper().size(); }
 
@@ -0,0 +1,265 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+
+#include "dispatch_cache.hpp"
+#include "cache_utils.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Sizes are reduced to a class since they are the part of a problem which
+// changes between the calls while the dispatch decision mostly does not.
+// Unit sizes are kept apart as they define broadcast and depthwise cases.
+dim_t dim_class(dim_t d) {
+    if (d == DNNL_RUNTIME_DIM_VAL) return -1;
+    return d == 1 ? 1 : 2;
+}
+
+void append_md(std::vector<dim_t> &sig, const memory_desc_t &md) {
+    sig.push_back(md.ndims);
+    sig.push_back(md.data_type);
+    sig.push_back(md.format_kind);
+    for (int d = 0; d < md.ndims; d++)
+        sig.push_back(dim_class(md.dims[d]));
+    sig.push_back(md.extra.flags);
+    if (md.format_kind != format_kind::blocked) return;
+
+    const auto &blk = md.format_desc.blocking;
+    sig.push_back(blk.inner_nblks);
+    for (int i = 0; i < blk.inner_nblks; i++) {
+        sig.push_back(blk.inner_blks[i]);
+        sig.push_back(blk.inner_idxs[i]);
+    }
+    // The order of the outer dimensions, their strides depend on sizes.
+    dims_t perm;
+    std::iota(perm, perm + md.ndims, 0);
+    std::stable_sort(perm, perm + md.ndims, [&](dim_t a, dim_t b) {
+        return blk.strides[a] > blk.strides[b];
+    });
+    sig.insert(sig.end(), perm, perm + md.ndims);
+}
+
+void append_dims(std::vector<dim_t> &sig, const dims_t dims, int ndims) {
+    sig.insert(sig.end(), dims, dims + ndims);
+}
+
+bool append_op_desc(std::vector<dim_t> &sig, const op_desc_t *op_desc) {
+    using namespace primitive_kind;
+    sig.push_back(op_desc->primitive_kind);
+    switch ((int)op_desc->primitive_kind) {
+        case convolution:
+        case deconvolution: {
+            const auto &d = *op_desc_t::to_desc<convolution_desc_t>(op_desc);
+            sig.push_back(d.prop_kind);
+            sig.push_back(d.alg_kind);
+            for (const auto *md : {&d.src_desc, &d.diff_src_desc,
+                         &d.weights_desc, &d.diff_weights_desc, &d.bias_desc,
+                         &d.diff_bias_desc, &d.dst_desc, &d.diff_dst_desc})
+                append_md(sig, *md);
+            // Kernel geometry is kept as is, it selects specialized kernels.
+            const bool is_bwd_d = d.prop_kind == prop_kind::backward_data;
+            const bool is_bwd_w = d.prop_kind == prop_kind::backward_weights;
+            const auto &src_d = is_bwd_d ? d.diff_src_desc : d.src_desc;
+            const auto &wei_d = is_bwd_w ? d.diff_weights_desc : d.weights_desc;
+            const int ndims_spat = src_d.ndims - 2;
+            append_dims(sig, wei_d.dims + wei_d.ndims - ndims_spat, ndims_spat);
+            append_dims(sig, d.strides, ndims_spat);
+            append_dims(sig, d.dilates, ndims_spat);
+            append_dims(sig, d.padding[0], ndims_spat);
+            append_dims(sig, d.padding[1], ndims_spat);
+            sig.push_back(d.accum_data_type);
+            sig.push_back(d.use_inversion);
+            return true;
+        }
+        case inner_product: {
+            const auto &d = *op_desc_t::to_desc<inner_product_desc_t>(op_desc);
+            sig.push_back(d.prop_kind);
+            for (const auto *md : {&d.src_desc, &d.diff_src_desc,
+                         &d.weights_desc, &d.diff_weights_desc, &d.bias_desc,
+                         &d.diff_bias_desc, &d.dst_desc, &d.diff_dst_desc})
+                append_md(sig, *md);
+            sig.push_back(d.accum_data_type);
+            return true;
+        }
+        case matmul: {
+            const auto &d = *op_desc_t::to_desc<matmul_desc_t>(op_desc);
+            for (const auto *md : {&d.src_desc, &d.weights_desc, &d.bias_desc,
+                         &d.dst_desc, &d.reduce_desc, &d.group_offsets_desc})
+                append_md(sig, *md);
+            sig.push_back(d.reduce_kind);
+            sig.push_back(d.accum_data_type);
+            return true;
+        }
+        default: return false;
+    }
+}
+
+} // namespace
+
+dispatch_key_t::dispatch_key_t(const engine_t *engine,
+        const op_desc_t *op_desc, const primitive_attr_t *attr,
+        int pd_iterator_offset, const std::vector<memory_desc_t> &hint_mds,
+        int skip_idx)
+    : attr_(attr)
+    , engine_id_(engine->engine_id())
+    , thread_id_(std::this_thread::get_id()) {
+    is_supported_ = append_op_desc(signature_, op_desc);
+    if (!is_supported_) return;
+
+    signature_.push_back(pd_iterator_offset);
+    signature_.push_back(skip_idx);
+    signature_.push_back(dnnl_get_max_threads());
+    signature_.push_back((dim_t)hint_mds.size());
+    for (const auto &md : hint_mds)
+        append_md(signature_, md);
+}
+
+bool dispatch_key_t::operator==(const dispatch_key_t &rhs) const {
+    DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
+    return is_supported_ == rhs.is_supported_ && engine_id_ == rhs.engine_id_
+            && signature_ == rhs.signature_ && *attr_ == *rhs.attr_;
+}
+
+size_t dispatch_key_t::hash() const {
+    size_t seed = engine_id_.hash();
+    seed = hash_combine(seed, primitive_hashing::get_attr_hash(*attr_));
+    return primitive_hashing::get_array_hash(
+            seed, signature_.data(), (int)signature_.size());
+}
+
+struct dispatch_cache_t {
+    using key_t = dispatch_key_t;
+    using entry_t = dispatch_cache_iface_t::entry_t;
+    using result_t = dispatch_cache_iface_t::result_t;
+
+    dispatch_cache_t(int capacity) : cache_(capacity) {};
+
+    status_t set_capacity(int capacity) {
+        return cache_.set_capacity(capacity);
+    }
+    int get_capacity() const { return cache_.get_capacity(); }
+    int get_size() const { return cache_.get_size(); }
+
+    result_t get(const key_t &key) { return cache_.get(key); }
+
+    void set(const key_t &key, int impl_idx,
+            const std::vector<dim_t> &layout_hints) {
+        // Entries are immutable as other threads may use them, an outdated
+        // one is replaced.
+        cache_.remove(key);
+        create_context_t ctx {key, impl_idx, layout_hints};
+        cache_.get_or_create(key, create, &ctx);
+    }
+
+private:
+    struct create_context_t {
+        const key_t &key;
+        int impl_idx;
+        const std::vector<dim_t> &layout_hints;
+    };
+
+    static result_t create(void *context) {
+        const auto &ctx = *static_cast<create_context_t *>(context);
+        return {std::make_shared<entry_t>(
+                        ctx.key, ctx.impl_idx, ctx.layout_hints),
+                status::success};
+    }
+
+    // The key passed to the cache points to the iterator copy of the
+    // attributes, re-point it to the one owned by the entry.
+    static void update_key(const key_t &key, const entry_t &e) {
+        key.attr_ = &e.attr;
+    }
+
+    utils::lru_cache_t<key_t, entry_t, result_t, update_key> cache_;
+};
+
+dispatch_cache_t &global_dispatch_cache() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    static const int capacity
+            = getenv_int_user("DISPATCH_CACHE_CAPACITY", 1024);
+#else
+    static const int capacity = 0;
+#endif
+    static dispatch_cache_t cache(capacity);
+    return cache;
+}
+
+dispatch_cache_iface_t dispatch_cache() {
+    return global_dispatch_cache();
+}
+
+// Undocumented API, for testing only
+status_t get_dispatch_cache_size(int *size) {
+    if (size == nullptr) return status::invalid_arguments;
+    *size = global_dispatch_cache().get_size();
+    return status::success;
+}
+
+status_t set_dispatch_cache_capacity(int capacity) {
+    if (capacity < 0) return status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return global_dispatch_cache().set_capacity(capacity);
+#endif
+    return status::success;
+}
+
+status_t dispatch_cache_iface_t::set_capacity(int capacity) {
+    return cache_.set_capacity(capacity);
+}
+
+int dispatch_cache_iface_t::get_capacity() const {
+    return cache_.get_capacity();
+}
+
+int dispatch_cache_iface_t::get_size() const {
+    return cache_.get_size();
+}
+
+dispatch_cache_iface_t::result_t dispatch_cache_iface_t::get(
+        const key_t &key) {
+    return cache_.get(key);
+}
+
+void dispatch_cache_iface_t::set(const key_t &key, int impl_idx,
+        const std::vector<dim_t> &layout_hints) {
+    cache_.set(key, impl_idx, layout_hints);
+}
+
+std::vector<dim_t> dispatch_cache_iface_t::get_layout_hints(
+        const primitive_desc_t *pd) {
+    std::vector<dim_t> hints;
+    for (const auto *md : {pd->src_md(0), pd->weights_md(0), pd->dst_md(0),
+                 pd->diff_src_md(0), pd->diff_weights_md(0),
+                 pd->diff_dst_md(0)})
+        append_md(hints, *md);
+    return hints;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
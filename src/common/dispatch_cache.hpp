@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DISPATCH_CACHE_HPP
+#define COMMON_DISPATCH_CACHE_HPP
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "engine_id.hpp"
+#include "oneapi/dnnl/dnnl.h"
+#include "primitive_attr.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_desc_t;
+struct dispatch_cache_t;
+
+// Shape agnostic signature of a primitive descriptor creation request. It
+// keeps the primitive and propagation kinds, data types, memory layouts,
+// attributes and engine but only a coarse class of every dimension (runtime,
+// one or any other value), so that problems differing only in sizes share
+// the same signature. Only primitives with an expensive dispatch are
+// supported, `is_supported()` is false for the rest.
+struct dispatch_key_t {
+    dispatch_key_t(const engine_t *engine, const op_desc_t *op_desc,
+            const primitive_attr_t *attr, int pd_iterator_offset,
+            const std::vector<memory_desc_t> &hint_mds, int skip_idx);
+
+    bool is_supported() const { return is_supported_; }
+    bool operator==(const dispatch_key_t &other) const;
+    size_t hash() const;
+
+    const std::thread::id &thread_id() const { return thread_id_; }
+    bool has_runtime_dependencies() const {
+        return !(engine_id_.kind() == engine_kind::cpu
+                && is_native_runtime(engine_id_.runtime_kind()));
+    }
+
+    // Points to the attributes owned by the cache entry once the key is
+    // stored in the cache.
+    mutable const primitive_attr_t *attr_;
+
+private:
+    bool is_supported_ = false;
+    std::vector<dim_t> signature_;
+    engine_id_t engine_id_;
+    std::thread::id thread_id_;
+};
+
+// Remembers which implementation of an impl list accepted a problem with a
+// given signature, together with the memory layouts it picked. On a hit only
+// that implementation is initialized, the impl list walk with every
+// `pd_t::init()` rejecting the problem is skipped. The hit is taken only if
+// the implementation picks the same layouts for the new sizes, otherwise the
+// regular walk follows and updates the entry.
+struct dispatch_cache_iface_t {
+    using key_t = dispatch_key_t;
+
+    struct entry_t {
+        entry_t(const key_t &key, int impl_idx,
+                const std::vector<dim_t> &layout_hints)
+            : impl_idx(impl_idx)
+            , layout_hints(layout_hints)
+            , attr(*key.attr_) {}
+
+        int impl_idx;
+        std::vector<dim_t> layout_hints;
+        primitive_attr_t attr;
+    };
+
+    struct result_t {
+        result_t() : status(status::success) {};
+        result_t(std::shared_ptr<entry_t> e, status_t s)
+            : value(std::move(e)), status(s) {}
+        bool is_empty() const { return value == nullptr; }
+        entry_t &get_value() const { return *value; }
+        std::shared_ptr<entry_t> value;
+        status_t status;
+    };
+
+    dispatch_cache_iface_t(dispatch_cache_t &cache) : cache_(cache) {};
+
+    status_t set_capacity(int capacity);
+    int get_capacity() const;
+    int get_size() const;
+
+    // Returns an empty result on a miss.
+    result_t get(const key_t &key);
+    void set(const key_t &key, int impl_idx,
+            const std::vector<dim_t> &layout_hints);
+
+    // Layouts of the primitive descriptor memory descriptors, used to check
+    // that a hit reproduces the blocking of the cached implementation choice.
+    static std::vector<dim_t> get_layout_hints(const primitive_desc_t *pd);
+
+private:
+    dispatch_cache_t &cache_;
+};
+
+dispatch_cache_iface_t dispatch_cache();
+
+// Undocumented API for testing.
+status_t DNNL_API get_dispatch_cache_size(int *size);
+status_t DNNL_API set_dispatch_cache_capacity(int capacity);
+
+} // namespace impl
+} // namespace dnnl
+
+namespace std {
+template <>
+struct hash<dnnl::impl::dispatch_key_t> {
+    size_t operator()(const dnnl::impl::dispatch_key_t &key) const {
+        return key.hash();
+    }
+};
+} // namespace std
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -1880,6 +1880,15 @@ const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     return "unknown scratchpad_mode";
 }
 
+const char *dnnl_huge_pages_mode2str(dnnl_huge_pages_mode_t v) {
+    if (v == dnnl_huge_pages_mode_any) return "any";
+    if (v == dnnl_huge_pages_mode_none) return "none";
+    if (v == dnnl_huge_pages_mode_transparent) return "transparent";
+    if (v == dnnl_huge_pages_mode_hugetlb) return "hugetlb";
+    assert(!"unknown huge_pages_mode");
+    return "unknown huge_pages_mode";
+}
+
 const char *dnnl_rounding_mode2str(dnnl_rounding_mode_t v) {
     if (v == dnnl_rounding_mode_environment) return "environment";
     if (v == dnnl_rounding_mode_stochastic) return "stochastic";
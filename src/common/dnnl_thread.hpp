@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "utils.hpp"
 #include "z_magic.hpp"
@@ -52,6 +54,46 @@
 #include "common/ittnotify.hpp"
 #endif
 
+namespace dnnl {
+namespace impl {
+namespace affinity_utils {
+
+// Each thread maintains a thread-local pointer to a list of cores which is
+// 'active' for the current thread. It is set for the duration of a primitive
+// execution on a stream with a CPU affinity. Threads of the parallel regions
+// created while a list is active are pinned to its cores in a round-robin
+// manner. Pinning is supported on Linux only and is a no-op elsewhere.
+//
+// The worker threads of OMP and TBB are not unpinned when the execution ends:
+// they keep their core until the next parallel region created without an
+// active list gives them their original affinity back.
+
+// Sets `cores` to be the active core list for the calling thread and
+// restricts the calling thread to these cores. Calls may be nested, e.g. when
+// a primitive executes other primitives on the same stream: nested calls keep
+// the outermost list and only the matching outermost
+// `deactivate_cpu_affinity()` restores the original affinity of the thread.
+// A thread already pinned to one of `cores` by a parallel region keeps its
+// core. Returns true if the active list of the calling thread changed.
+bool activate_cpu_affinity(
+        const std::shared_ptr<const std::vector<int>> &cores);
+
+// Ends the activation started by the matching `activate_cpu_affinity()`.
+// Returns true if the active list of the calling thread changed.
+bool deactivate_cpu_affinity();
+
+// Returns the active core list for the calling thread.
+const std::vector<int> *get_active_cpu_affinity();
+
+// Pins the calling thread to `cores[ithr % cores->size()]`. When `cores` is
+// nullptr, a thread pinned by a previous call gets its original affinity
+// back. The pinned core is cached, so repeated calls are cheap.
+void bind_thread_to_cpu_affinity(const std::vector<int> *cores, int ithr);
+
+} // namespace affinity_utils
+} // namespace impl
+} // namespace dnnl
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -286,12 +328,15 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
         f(0, 1);
         return;
     }
+    using namespace dnnl::impl::affinity_utils;
+    const std::vector<int> *cores = get_active_cpu_affinity();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
 #pragma omp parallel num_threads(nthr)
     {
         int nthr_ = omp_get_num_threads();
         int ithr_ = omp_get_thread_num();
         assert(nthr_ == nthr);
+        bind_thread_to_cpu_affinity(cores, ithr_);
 #if defined(DNNL_ENABLE_ITT_TASKS)
         if (ithr_ && itt_enable) itt::primitive_task_start(task_primitive_kind);
 #endif
@@ -304,6 +349,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     tbb::parallel_for(
             0, nthr,
             [&](int ithr) {
+                bind_thread_to_cpu_affinity(cores, ithr);
 #if defined(DNNL_ENABLE_ITT_TASKS)
                 bool mark_task = itt::primitive_task_get_current_kind()
                         == primitive_kind::undefined;
@@ -332,6 +378,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
         if (async) b.init(nthr);
         tp->parallel_for(nthr, [&, tp](int ithr, int nthr) {
             bool is_master = threadpool_utils::get_active_threadpool() == tp;
+            bind_thread_to_cpu_affinity(cores, ithr);
             if (!is_master) {
                 threadpool_utils::activate_threadpool(tp);
 #if defined(DNNL_ENABLE_ITT_TASKS)
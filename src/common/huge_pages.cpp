@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "c_types_map.hpp"
+#include "huge_pages.hpp"
+#include "memory_debug.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+static setting_t<huge_pages_mode_t> default_huge_pages {huge_pages_mode::none};
+
+namespace {
+
+void init_huge_pages_mode() {
+    if (default_huge_pages.initialized()) return;
+
+    static std::string val = getenv_string_user("HUGE_PAGES");
+    if (!val.empty()) {
+        if (val.compare("none") == 0)
+            default_huge_pages.set(huge_pages_mode::none);
+        if (val.compare("transparent") == 0)
+            default_huge_pages.set(huge_pages_mode::transparent);
+        if (val.compare("hugetlb") == 0)
+            default_huge_pages.set(huge_pages_mode::hugetlb);
+    }
+    if (!default_huge_pages.initialized())
+        default_huge_pages.set(default_huge_pages.get());
+}
+
+#ifdef __linux__
+// Returns the transparent huge page size or 0 if transparent huge pages are
+// not supported or disabled system-wide.
+size_t query_thp_page_size() {
+    std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string policy;
+    // The active policy is bracketed, e.g. "always [madvise] never".
+    if (!std::getline(enabled, policy)
+            || policy.find("[never]") != std::string::npos)
+        return 0;
+
+    std::ifstream pmd_size(
+            "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    size_t size = 0;
+    if (!(pmd_size >> size)) size = 2 * 1024 * 1024;
+    return size;
+}
+
+// Returns the default explicit huge page size or 0 if it is unknown.
+size_t query_hugetlb_page_size() {
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    while (meminfo >> key) {
+        if (key == "Hugepagesize:") {
+            size_t size_kb = 0;
+            return (meminfo >> size_kb) ? size_kb * 1024 : 0;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+}
+#endif
+
+size_t thp_page_size() {
+#ifdef __linux__
+    static const size_t size = query_thp_page_size();
+    return size;
+#else
+    return 0;
+#endif
+}
+
+size_t hugetlb_page_size() {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    static const size_t size = query_hugetlb_page_size();
+    return size;
+#else
+    return 0;
+#endif
+}
+
+// Explicit huge pages are mapped directly and have to be unmapped with their
+// size, so such buffers are tracked separately from the regular ones.
+struct hugetlb_registry_t {
+    std::mutex mutex;
+    std::unordered_map<void *, size_t> sizes;
+    std::atomic<size_t> count {0};
+};
+
+hugetlb_registry_t &hugetlb_registry() {
+    // Never destroyed as buffers may be released at exit after static
+    // objects are gone.
+    static auto *registry = new hugetlb_registry_t();
+    return *registry;
+}
+
+} // namespace
+
+huge_pages_mode_t get_huge_pages_mode() {
+    init_huge_pages_mode();
+    return default_huge_pages.get();
+}
+
+size_t get_huge_page_size(huge_pages_mode_t mode) {
+    if (mode == huge_pages_mode::any) mode = get_huge_pages_mode();
+
+    size_t size = 0;
+    if (mode == huge_pages_mode::hugetlb) size = hugetlb_page_size();
+    if (size == 0 && mode != huge_pages_mode::none) size = thp_page_size();
+    return size ? size : static_cast<size_t>(getpagesize());
+}
+
+void *malloc_huge_pages(size_t size, int alignment, huge_pages_mode_t mode) {
+    if (mode == huge_pages_mode::any) mode = get_huge_pages_mode();
+    if (mode == huge_pages_mode::none || memory_debug::is_mem_debug())
+        return malloc(size, alignment);
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    const size_t hugetlb_page = hugetlb_page_size();
+    if (mode == huge_pages_mode::hugetlb && hugetlb_page != 0
+            && size >= hugetlb_page) {
+        const size_t mapped_size = utils::rnd_up(size, hugetlb_page);
+        void *ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            auto &registry = hugetlb_registry();
+            std::lock_guard<std::mutex> guard(registry.mutex);
+            registry.sizes[ptr] = mapped_size;
+            registry.count++;
+            return ptr;
+        }
+        VWARN(common, huge_pages,
+                "could not map %zu bytes of explicit huge pages, falling "
+                "back to transparent huge pages",
+                mapped_size);
+    }
+#endif
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const size_t thp_page = thp_page_size();
+    if (thp_page != 0 && size >= thp_page) {
+        // Aligning the buffer to the huge page size lets the kernel back the
+        // whole buffer with huge pages instead of only its aligned middle.
+        const size_t aligned_size = utils::rnd_up(size, thp_page);
+        void *ptr = malloc(aligned_size, static_cast<int>(thp_page));
+        if (ptr) ::madvise(ptr, aligned_size, MADV_HUGEPAGE);
+        return ptr;
+    }
+#endif
+
+    return malloc(size, alignment);
+}
+
+void free_huge_pages(void *ptr) {
+    if (!ptr) return;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    auto &registry = hugetlb_registry();
+    if (registry.count > 0) {
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        auto it = registry.sizes.find(ptr);
+        if (it != registry.sizes.end()) {
+            ::munmap(ptr, it->second);
+            registry.sizes.erase(it);
+            registry.count--;
+            return;
+        }
+    }
+#endif
+
+    free(ptr);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
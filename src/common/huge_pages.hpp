@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_HUGE_PAGES_HPP
+#define COMMON_HUGE_PAGES_HPP
+
+#include <cstddef>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Returns the library huge pages mode set with the ONEDNN_HUGE_PAGES
+// environment variable. Never returns huge_pages_mode::any.
+huge_pages_mode_t get_huge_pages_mode();
+
+// Returns the size of the pages backing large buffers allocated in `mode`.
+// Falls back to the regular page size when huge pages are not available.
+size_t get_huge_page_size(huge_pages_mode_t mode);
+
+// Allocates a buffer backed by huge pages according to `mode`, where
+// huge_pages_mode::any stands for the library mode. Buffers smaller than a
+// huge page are allocated with regular pages. The buffer must be released with
+// free_huge_pages().
+void *malloc_huge_pages(size_t size, int alignment, huge_pages_mode_t mode);
+void free_huge_pages(void *ptr);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
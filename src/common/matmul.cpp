@@ -449,6 +449,62 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
             dst_desc, nullptr, matmul_reduce_kind::undef);
 }
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *group_offsets_desc,
+        const memory_desc_t *dst_desc) {
+    VCHECK_MATMUL(!any_null(src_desc, weights_desc, group_offsets_desc,
+                          dst_desc),
+            VERBOSE_NULL_ARG);
+
+    auto op_d = matmul_desc_t();
+    op_d.primitive_kind = primitive_kind::matmul;
+
+    op_d.src_desc = *src_desc;
+    op_d.weights_desc = *weights_desc;
+    op_d.dst_desc = *dst_desc;
+    op_d.group_offsets_desc = *group_offsets_desc;
+
+    // Rows of src and dst are split into groups, each group is multiplied by
+    // its own slice of the stacked weights.
+    VCHECK_MATMUL(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_MATMUL(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_MATMUL(weights_desc->ndims == 3, VERBOSE_BAD_NDIMS, "weights",
+            weights_desc->ndims);
+    VCHECK_MATMUL(group_offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "group_offsets", group_offsets_desc->ndims);
+    VCHECK_MATMUL(group_offsets_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "group_offsets");
+    VCHECK_MATMUL(group_offsets_desc->format_kind != format_kind::any,
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    // Only the total number of rows may be defined at execution time.
+    const dim_t G = weights_desc->dims[0];
+    const dim_t K = weights_desc->dims[1];
+    const dim_t N = weights_desc->dims[2];
+    VCHECK_MATMUL(!one_of(DNNL_RUNTIME_DIM_VAL, G, K, N,
+                          group_offsets_desc->dims[0], src_desc->dims[1],
+                          dst_desc->dims[1]),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_MATMUL(group_offsets_desc->dims[0] == G + 1,
+            VERBOSE_INCONSISTENT_DIM, "group_offsets", 0, "weights", 0);
+    VCHECK_MATMUL(dst_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    VCHECK_MATMUL(src_desc->dims[1] == K, VERBOSE_INCONSISTENT_DIM, "src", 1,
+            "weights", 1);
+    VCHECK_MATMUL(dst_desc->dims[1] == N, VERBOSE_INCONSISTENT_DIM, "dst", 1,
+            "weights", 2);
+
+    op_d.accum_data_type = types::default_accum_data_type(src_desc->data_type,
+            weights_desc->data_type, dst_desc->data_type, prop_kind::forward);
+    VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+            VERBOSE_INVALID_DATATYPE, "accumulation");
+    *matmul_desc = op_d;
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -464,3 +520,16 @@ status_t dnnl_matmul_primitive_desc_create(
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&matmul_desc, nullptr, attr);
 }
+
+status_t dnnl_grouped_matmul_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *group_offsets_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+    auto matmul_desc = matmul_desc_t();
+    CHECK(grouped_matmul_desc_init(&matmul_desc, src_desc, weights_desc,
+            group_offsets_desc, dst_desc));
+    CHECK(matmul_attr_check(matmul_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&matmul_desc, nullptr, attr);
+}
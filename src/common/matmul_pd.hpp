@@ -45,6 +45,11 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
         const memory_desc_t *bias_desc, const memory_desc_t *dst_desc);
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *group_offsets_desc,
+        const memory_desc_t *dst_desc);
+
 // NOLINTBEGIN(google-default-arguments)
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
@@ -61,6 +66,9 @@ struct matmul_pd_t : public primitive_desc_t {
         const bool input = utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS);
         if (input) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_GROUP_OFFSETS)
+            return with_groups() ? arg_usage_t::input : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_BIAS)
             return with_bias() ? arg_usage_t::input : arg_usage_t::unused;
 
@@ -79,6 +87,7 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             case DNNL_ARG_REDUCE: return reduce_md(0);
+            case DNNL_ARG_GROUP_OFFSETS: return group_offsets_md();
             default: return primitive_desc_t::arg_md(arg);
         }
     }
@@ -109,8 +118,13 @@ struct matmul_pd_t : public primitive_desc_t {
         return &glob_zero_md;
     }
 
+    const memory_desc_t *group_offsets_md() const {
+        return &desc_.group_offsets_desc;
+    }
+
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + with_groups() + n_binary_po_inputs()
+                + n_prelu_po_inputs();
     }
     int n_outputs() const override { return 1 + with_reduce(); }
 
@@ -130,6 +144,7 @@ struct matmul_pd_t : public primitive_desc_t {
 
     bool with_bias() const { return bias_md_.ndims != 0; }
     bool with_reduce() const { return reduce_md_.ndims != 0; }
+    bool with_groups() const { return desc_.group_offsets_desc.ndims != 0; }
 
     matmul_reduce_kind_t reduce_kind() const { return desc_.reduce_kind; }
 
@@ -263,6 +263,8 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_lrn_buffer,
+    key_lrn_tmp,
     key_matmul_pack_space,
     key_matmul_dst_in_acc_dt,
     key_matmul_lt_algo_scratch,
@@ -318,6 +320,8 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rnn_src_iter_c_stage,
+    key_rnn_src_iter_stage,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
@@ -442,6 +442,17 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_huge_pages_mode(
+        huge_pages_mode_t huge_pages_mode) {
+    const bool ok = one_of(huge_pages_mode, huge_pages_mode::any,
+            huge_pages_mode::none, huge_pages_mode::transparent,
+            huge_pages_mode::hugetlb);
+    if (!ok) return invalid_arguments;
+
+    huge_pages_mode_ = huge_pages_mode;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     post_ops_ = post_ops;
     return status::success;
@@ -565,6 +576,22 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_huge_pages_mode(
+        const primitive_attr_t *attr, huge_pages_mode_t *huge_pages_mode) {
+    if (any_null(attr, huge_pages_mode)) return invalid_arguments;
+
+    *huge_pages_mode = attr->huge_pages_mode_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_huge_pages_mode(
+        primitive_attr_t *attr, huge_pages_mode_t huge_pages_mode) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_huge_pages_mode(huge_pages_mode);
+}
+
 status_t dnnl_primitive_attr_set_scales_mask(
         primitive_attr_t *attr, int arg, int mask) {
     VCHECK_ATTR(attr, VERBOSE_NULL_ARG);
@@ -533,6 +533,7 @@ private:
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
+        , huge_pages_mode_(dnnl::impl::huge_pages_mode::any)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
         , deterministic_(false) {}
@@ -556,6 +557,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         zero_points_ = other.zero_points_;
         rounding_mode_ = other.rounding_mode_;
         scratchpad_mode_ = other.scratchpad_mode_;
+        huge_pages_mode_ = other.huge_pages_mode_;
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
@@ -596,7 +598,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_ and huge_pages_mode_ are not take into
+     * account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -605,6 +608,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
+                && huge_pages_mode_ == rhs.huge_pages_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
@@ -630,6 +634,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             const dnnl::impl::memory_desc_t *dropout_desc);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_huge_pages_mode(
+            dnnl::impl::huge_pages_mode_t huge_pages_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
     dnnl::impl::status_t set_gpu_attr(
             const dnnl::impl::primitive_attr_item_t &gpu_attr);
@@ -684,6 +690,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::scales_t scales_;
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
+    dnnl::impl::huge_pages_mode_t huge_pages_mode_;
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
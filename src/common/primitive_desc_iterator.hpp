@@ -17,9 +17,12 @@
 #ifndef COMMON_PRIMITIVE_DESC_ITERATOR_HPP
 #define COMMON_PRIMITIVE_DESC_ITERATOR_HPP
 
+#include <cstring>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dispatch_cache.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_attr.hpp"
@@ -80,6 +83,11 @@ struct primitive_desc_iterator_t : public c_compatible {
         pd_ = primitive_cache().get_pd(key);
         if (pd_) { return *this; }
 
+        dispatch_key_t dispatch_key(
+                engine_, op_desc_.get(), &attr_, offset_, hint_mds, skip_idx_);
+        if (dispatch_key.is_supported() && try_dispatch_hit(dispatch_key))
+            return *this;
+
         while (++idx_ != last_idx_) {
             if (idx_ == skip_idx_) continue;
             primitive_desc_t *candidate_pd = nullptr;
@@ -87,6 +95,14 @@ struct primitive_desc_iterator_t : public c_compatible {
                     engine_, hint_fwd_pd_, offset_, skip_idx_);
             if (s == status::success) {
                 pd_.reset(candidate_pd);
+                // Reference implementations usually win only because of a
+                // size specific limitation, they are not a good guess for
+                // other sizes.
+                if (dispatch_key.is_supported()
+                        && strstr(pd_->name(), "ref") == nullptr)
+                    dispatch_cache().set(dispatch_key, idx_,
+                            dispatch_cache_iface_t::get_layout_hints(
+                                    pd_.get()));
                 break;
             }
         }
@@ -112,6 +128,31 @@ protected:
     int offset_;
 
 private:
+    // Initializes only the implementation which accepted a problem with the
+    // same signature before. The hit is taken when it accepts the current
+    // problem with the same layouts, otherwise the regular walk follows.
+    bool try_dispatch_hit(const dispatch_key_t &dispatch_key) {
+        const auto dispatched = dispatch_cache().get(dispatch_key);
+        if (dispatched.is_empty()) return false;
+
+        const auto &e = dispatched.get_value();
+        if (e.impl_idx <= idx_ || e.impl_idx >= last_idx_) return false;
+
+        primitive_desc_t *candidate_pd = nullptr;
+        auto s = impl_list_[e.impl_idx](&candidate_pd, op_desc_.get(), &attr_,
+                engine_, hint_fwd_pd_, offset_, skip_idx_);
+        if (s != status::success) return false;
+
+        std::shared_ptr<primitive_desc_t> pd(candidate_pd);
+        if (dispatch_cache_iface_t::get_layout_hints(pd.get())
+                != e.layout_hints)
+            return false;
+
+        idx_ = e.impl_idx;
+        pd_ = std::move(pd);
+        return true;
+    }
+
     primitive_desc_iterator_t(engine_t *engine, int last_idx)
         : idx_(last_idx)
         , engine_(engine)
@@ -222,6 +222,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     size_t seed = 0;
     // scratchpad_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
+    // huge_pages_mode
+    seed = hash_combine(seed, static_cast<size_t>(attr.huge_pages_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.mode_));
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
@@ -537,6 +539,8 @@ size_t get_desc_hash(const matmul_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.reduce_desc));
     // Reduce kind.
     seed = hash_combine(seed, static_cast<size_t>(desc.reduce_kind));
+    // Group offsets
+    seed = hash_combine(seed, get_md_hash(desc.group_offsets_desc));
     // Accumulator type
     seed = hash_combine(seed, static_cast<size_t>(desc.accum_data_type));
     // Combined hash for matmul op desc
@@ -284,14 +284,19 @@ status_t dnnl_primitive::init() {
     const size_t scratchpad_size
             = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
 
-    if (scratchpad_size) {
+    use_scratchpad_pool_ = scratchpad_size
+            && !scratchpad_debug::is_protect_scratchpad()
+            && use_scratchpad_pool(pd_->engine());
+
+    if (scratchpad_size && !use_scratchpad_pool_) {
         const memory_tracking::registry_t &registry
                 = primitive_->pd()->scratchpad_registry();
         bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
                 ? false
                 : primitive_->use_global_scratchpad();
-        auto *scratchpad_ptr = create_scratchpad(
-                pd_->engine(), scratchpad_size, use_global_scratchpad);
+        auto *scratchpad_ptr = create_scratchpad(pd_->engine(),
+                scratchpad_size, use_global_scratchpad,
+                pd_->attr()->huge_pages_mode_);
         if (scratchpad_ptr == nullptr) return out_of_memory;
         if (scratchpad_ptr->get_memory_storage() == nullptr) {
             delete scratchpad_ptr;
@@ -318,12 +323,19 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     const memory_storage_t *mem_storage = nullptr;
+    const memory_storage_t *pooled_mem_storage = nullptr;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
+    } else if (use_scratchpad_pool_) {
+        pooled_mem_storage = ctx.stream()->scratchpad_pool().acquire(engine(),
+                primitive_->pd()->scratchpad_size(scratchpad_mode::library),
+                pd_->attr()->huge_pages_mode_);
+        if (!pooled_mem_storage) return status::out_of_memory;
+        mem_storage = pooled_mem_storage;
     }
 
     auto scratchpad_grantor
@@ -333,6 +345,8 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+    if (pooled_mem_storage)
+        ctx.stream()->scratchpad_pool().release(pooled_mem_storage);
     return status;
 }
 
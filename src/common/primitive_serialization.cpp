@@ -178,6 +178,8 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
 void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     // scratchpad_mode
     sstream.append(attr.scratchpad_mode_);
+    // huge_pages_mode
+    sstream.append(attr.huge_pages_mode_);
     // fpmath_mode
     sstream.append(attr.fpmath_.mode_);
     sstream.append(attr.fpmath_.apply_to_int_);
@@ -417,6 +419,7 @@ void serialize(serialization_stream_t &sstream, const matmul_desc_t &desc) {
     serialize(sstream, desc.weights_desc);
     serialize(sstream, desc.bias_desc);
     serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.group_offsets_desc);
     // Accumulator type
     sstream.append(desc.accum_data_type);
 }
@@ -14,13 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <memory>
 
 #include "engine.hpp"
 #include "utils.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "common/dnnl_thread.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/cpu_memory_storage.hpp"
+#include "cpu/platform.hpp"
 #endif
 
 #include "scratchpad.hpp"
@@ -30,8 +34,29 @@ namespace impl {
 
 namespace {
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+// Writes to every page of a fresh scratchpad from the threads of a parallel
+// region. With the first-touch policy of the OS the pages then get placed on
+// the node of the thread touching them, which is usually the thread using them
+// as primitives split the scratchpad into per-thread chunks in the same order.
+void numa_first_touch(const memory_storage_t *mem_storage, size_t size) {
+    void *ptr = nullptr;
+    if (mem_storage->get_data_handle(&ptr) != status::success || !ptr) return;
+
+    const size_t page_size = cpu::PAGE_4K;
+    const size_t npages = utils::div_up(size, page_size);
+    char *base = static_cast<char *>(ptr);
+    parallel(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211(npages, nthr, ithr, start, end);
+        for (size_t p = start; p < end; p++)
+            base[p * page_size] = 0;
+    });
+}
+#endif
+
 memory_storage_t *create_scratchpad_memory_storage(
-        engine_t *engine, size_t size) {
+        engine_t *engine, size_t size, huge_pages_mode_t huge_pages_mode) {
     // XXX: if engine is a non-native CPU engine (read: SYCL) then create
     // scratchpad through other, native CPU engine.
     //
@@ -50,14 +75,46 @@ memory_storage_t *create_scratchpad_memory_storage(
             : engine;
 #else
     mem_engine = engine;
+    MAYBE_UNUSED(huge_pages_mode);
 #endif
 
     memory_storage_t *mem_storage = nullptr;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (mem_engine->kind() == engine_kind::cpu
+            && is_native_runtime(mem_engine->runtime_kind())) {
+        auto *cpu_storage
+                = new cpu::cpu_memory_storage_t(mem_engine, huge_pages_mode);
+        if (cpu_storage
+                && cpu_storage->init(memory_flags_t::alloc, size, nullptr)
+                        == status::success)
+            mem_storage = cpu_storage;
+        else
+            delete cpu_storage;
+    } else {
+        auto status = mem_engine->create_memory_storage(&mem_storage, size);
+        MAYBE_UNUSED(status);
+    }
+    if (mem_storage && mem_engine->kind() == engine_kind::cpu
+            && cpu::platform::is_numa_aware())
+        numa_first_touch(mem_storage, size);
+#else
     auto status = mem_engine->create_memory_storage(&mem_storage, size);
     MAYBE_UNUSED(status);
+#endif
     return mem_storage;
 }
 
+// Rounds `size` up to its size class. Classes start at 4 KB and are spaced by
+// a quarter of a power of two, which bounds the rounding overhead by 25%.
+size_t get_size_class(size_t size) {
+    const size_t min_class_size = 4096;
+    if (size <= min_class_size) return min_class_size;
+    size_t pow2 = min_class_size;
+    while (2 * pow2 < size)
+        pow2 *= 2;
+    return utils::rnd_up(size, pow2 / 4);
+}
+
 } // namespace
 
 /*
@@ -65,8 +122,11 @@ memory_storage_t *create_scratchpad_memory_storage(
   a concurrent execution
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
-    concurrent_scratchpad_t(engine_t *engine, size_t size) : size_(size) {
-        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
+    concurrent_scratchpad_t(engine_t *engine, size_t size,
+            huge_pages_mode_t huge_pages_mode)
+        : size_(size) {
+        auto *mem_storage = create_scratchpad_memory_storage(
+                engine, size, huge_pages_mode);
         if (mem_storage == nullptr) size_ = 0;
 
         mem_storage_.reset(mem_storage);
@@ -91,15 +151,18 @@ private:
 */
 
 struct global_scratchpad_t : public scratchpad_t {
-    global_scratchpad_t(engine_t *engine, size_t size) {
+    global_scratchpad_t(engine_t *engine, size_t size,
+            huge_pages_mode_t huge_pages_mode) {
         // TODO: check if engine is the same
         if (size > size_) {
             delete mem_storage_;
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
+            mem_storage_ = create_scratchpad_memory_storage(
+                    engine, size, huge_pages_mode);
             if (mem_storage_ == nullptr) {
                 // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
+                mem_storage_ = create_scratchpad_memory_storage(
+                        engine, size_, huge_pages_mode);
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
                 size_ = size;
@@ -138,11 +201,101 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+/*
+   Implementation of the stream scratchpad pool
+*/
+bool use_scratchpad_pool(const engine_t *engine) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // The buffer is given back to the pool when the primitive returns, which
+    // is only safe when the execution is complete by then.
+    static const bool enabled = getenv_int_user("SCRATCHPAD_POOL", 0) > 0;
+    return enabled && engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind());
+#else
+    UNUSED(engine);
+    return false;
+#endif
+}
+
+scratchpad_pool_t::scratchpad_pool_t() : stats_() {
+    static const int limit_mb = getenv_int_user("SCRATCHPAD_POOL_LIMIT", 0);
+    stats_.limit = limit_mb > 0 ? static_cast<size_t>(limit_mb) << 20 : 0;
+}
+
+memory_storage_t *scratchpad_pool_t::acquire(
+        engine_t *engine, size_t size, huge_pages_mode_t huge_pages_mode) {
+    const size_t class_size = get_size_class(size);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    block_t block;
+    auto &free_list = free_blocks_[class_size];
+    auto it = std::find_if(
+            free_list.begin(), free_list.end(), [&](const block_t &b) {
+                return b.huge_pages_mode == huge_pages_mode;
+            });
+    if (it != free_list.end()) {
+        block = std::move(*it);
+        free_list.erase(it);
+        stats_.hits++;
+    } else {
+        block.mem_storage.reset(create_scratchpad_memory_storage(
+                engine, class_size, huge_pages_mode));
+        if (!block.mem_storage) return nullptr;
+        block.size = class_size;
+        block.huge_pages_mode = huge_pages_mode;
+        stats_.capacity += class_size;
+        stats_.misses++;
+    }
+    stats_.in_use += class_size;
+    stats_.peak_in_use = std::max(stats_.peak_in_use, stats_.in_use);
+
+    memory_storage_t *mem_storage = block.mem_storage.get();
+    used_blocks_.emplace(mem_storage, std::move(block));
+    trim();
+    return mem_storage;
+}
+
+void scratchpad_pool_t::release(const memory_storage_t *mem_storage) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = used_blocks_.find(mem_storage);
+    assert(it != used_blocks_.end());
+    if (it == used_blocks_.end()) return;
+
+    block_t block = std::move(it->second);
+    used_blocks_.erase(it);
+    stats_.in_use -= block.size;
+    free_blocks_[block.size].push_back(std::move(block));
+    trim();
+}
+
+scratchpad_pool_stats_t scratchpad_pool_t::stats() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return stats_;
+}
+
+void scratchpad_pool_t::set_limit(size_t limit) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stats_.limit = limit;
+    trim();
+}
+
+void scratchpad_pool_t::trim() {
+    if (stats_.limit == 0) return;
+    for (auto &entry : free_blocks_) {
+        auto &free_list = entry.second;
+        while (stats_.capacity > stats_.limit && !free_list.empty()) {
+            stats_.capacity -= free_list.back().size;
+            free_list.pop_back();
+        }
+    }
+}
+
 /*
    Scratchpad creation routine
 */
-scratchpad_t *create_scratchpad(
-        engine_t *engine, size_t size, bool use_global_scratchpad) {
+scratchpad_t *create_scratchpad(engine_t *engine, size_t size,
+        bool use_global_scratchpad, huge_pages_mode_t huge_pages_mode) {
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
@@ -150,12 +303,12 @@ scratchpad_t *create_scratchpad(
      * lock global scratchpad to work with CPU engine only.
      */
     if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu)
-        return new global_scratchpad_t(engine, size);
+        return new global_scratchpad_t(engine, size, huge_pages_mode);
     else
-        return new concurrent_scratchpad_t(engine, size);
+        return new concurrent_scratchpad_t(engine, size, huge_pages_mode);
 #else
     UNUSED(use_global_scratchpad);
-    return new concurrent_scratchpad_t(engine, size);
+    return new concurrent_scratchpad_t(engine, size, huge_pages_mode);
 #endif
 }
 
@@ -17,6 +17,11 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "c_types_map.hpp"
 #include "memory_storage.hpp"
 #include "utils.hpp"
@@ -30,8 +35,54 @@ struct scratchpad_t {
     virtual size_t size() const = 0;
 };
 
-scratchpad_t *create_scratchpad(
-        engine_t *engine, size_t size, bool use_global_scratchpad);
+// The library managed scratchpad is backed by pages according to
+// `huge_pages_mode` on CPU, where huge_pages_mode::any stands for the library
+// mode.
+scratchpad_t *create_scratchpad(engine_t *engine, size_t size,
+        bool use_global_scratchpad,
+        huge_pages_mode_t huge_pages_mode = huge_pages_mode::any);
+
+// Returns true if primitives created on `engine` take their library managed
+// scratchpad from the pool of the stream at execution instead of holding one.
+// Enabled with ONEDNN_SCRATCHPAD_POOL=1 for CPU engines with synchronous
+// execution.
+bool use_scratchpad_pool(const engine_t *engine);
+
+// Caches the scratchpad buffers of the primitives executed on a stream.
+// Requests are rounded up to size classes spaced by a quarter of a power of
+// two, and a buffer returns to the free list of its class once the execution
+// is over, so that primitives with similar scratchpad sizes share buffers.
+struct scratchpad_pool_t {
+    scratchpad_pool_t();
+    ~scratchpad_pool_t() = default;
+
+    // Returns a buffer of at least `size` bytes or nullptr on failure. The
+    // buffer must be given back with release().
+    memory_storage_t *acquire(
+            engine_t *engine, size_t size, huge_pages_mode_t huge_pages_mode);
+    void release(const memory_storage_t *mem_storage);
+
+    scratchpad_pool_stats_t stats() const;
+    // Sets the maximum number of bytes held by the pool, 0 for no limit.
+    void set_limit(size_t limit);
+
+private:
+    struct block_t {
+        std::unique_ptr<memory_storage_t> mem_storage;
+        size_t size;
+        huge_pages_mode_t huge_pages_mode;
+    };
+
+    void trim();
+
+    mutable std::mutex mutex_;
+    // Free blocks keyed by their size class.
+    std::unordered_map<size_t, std::vector<block_t>> free_blocks_;
+    std::unordered_map<const memory_storage_t *, block_t> used_blocks_;
+    scratchpad_pool_stats_t stats_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
 
 } // namespace impl
 } // namespace dnnl
@@ -15,7 +15,15 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -37,6 +45,33 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+status_t stream_t::set_cpu_affinity(const std::vector<int> &cores) {
+    VERROR_ENGINE(engine_->kind() == engine_kind::cpu
+                    && is_native_runtime(engine_->runtime_kind()),
+            unimplemented, "cpu affinity requires a native cpu engine");
+#if defined(__linux__)
+    cpu_set_t allowed;
+    if (!cores.empty()
+            && ::sched_getaffinity(::getpid(), sizeof(cpu_set_t), &allowed)
+                    != 0)
+        return runtime_error;
+    for (int core : cores) {
+        VERROR_ENGINE(core >= 0 && core < CPU_SETSIZE
+                        && CPU_ISSET(core, &allowed),
+                invalid_arguments, "core %d is not available to the process",
+                core);
+    }
+#else
+    VERROR_ENGINE(cores.empty(), unimplemented,
+            "cpu affinity is not supported on this platform");
+#endif
+    std::shared_ptr<const std::vector<int>> affinity;
+    if (!cores.empty()) affinity = std::make_shared<std::vector<int>>(cores);
+    std::lock_guard<std::mutex> guard(cpu_affinity_mutex_);
+    cpu_affinity_ = std::move(affinity);
+    return success;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
@@ -65,6 +100,40 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_get_scratchpad_pool_stats(
+        const stream_t *stream, scratchpad_pool_stats_t *stats) {
+    if (any_null(stream, stats)) return invalid_arguments;
+    *stats = stream->scratchpad_pool().stats();
+    return success;
+}
+
+status_t dnnl_stream_set_scratchpad_pool_limit(
+        stream_t *stream, size_t limit) {
+    if (any_null(stream)) return invalid_arguments;
+    stream->scratchpad_pool().set_limit(limit);
+    return success;
+}
+
+status_t dnnl_stream_set_cpu_affinity(
+        stream_t *stream, int ncores, const int *cores) {
+    if (any_null(stream) || ncores < 0 || (ncores > 0 && !cores))
+        return invalid_arguments;
+    return stream->set_cpu_affinity(std::vector<int>(cores, cores + ncores));
+}
+
+status_t dnnl_stream_get_cpu_affinity(
+        const stream_t *stream, int *ncores, int *cores) {
+    if (any_null(stream, ncores)) return invalid_arguments;
+    const auto affinity = stream->cpu_affinity();
+    const int size = affinity ? (int)affinity->size() : 0;
+    if (cores && size > 0) {
+        if (*ncores < size) return invalid_arguments;
+        std::copy(affinity->begin(), affinity->end(), cores);
+    }
+    *ncores = size;
+    return success;
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
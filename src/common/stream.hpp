@@ -18,11 +18,16 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
+#include "common/scratchpad.hpp"
 #include "common/stream_impl.hpp"
 #include "common/utils.hpp"
 
@@ -78,6 +83,19 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     dnnl::impl::stream_impl_t *impl() { return impl_.get(); }
 
+    dnnl::impl::scratchpad_pool_t &scratchpad_pool() const {
+        return scratchpad_pool_;
+    }
+
+    /** returns the cores the parallel regions of the stream are pinned to,
+     * nullptr if the stream has no CPU affinity. The list is immutable and is
+     * kept alive by the returned pointer when the affinity is changed. */
+    std::shared_ptr<const std::vector<int>> cpu_affinity() const {
+        std::lock_guard<std::mutex> guard(cpu_affinity_mutex_);
+        return cpu_affinity_;
+    }
+    dnnl::impl::status_t set_cpu_affinity(const std::vector<int> &cores);
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -91,6 +109,9 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    mutable dnnl::impl::scratchpad_pool_t scratchpad_pool_;
+    std::shared_ptr<const std::vector<int>> cpu_affinity_;
+    mutable std::mutex cpu_affinity_mutex_;
 };
 
 #endif
@@ -825,6 +825,7 @@ inline bool operator==(const matmul_desc_t &lhs, const matmul_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(reduce_desc)
             && COMPARE_DESC_MEMBERS(reduce_kind)
+            && COMPARE_DESC_MEMBERS(group_offsets_desc)
             && COMPARE_DESC_MEMBERS(accum_data_type);
     return ret;
 }
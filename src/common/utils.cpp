@@ -24,6 +24,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #if defined(__unix__) || defined(__APPLE__)
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -34,8 +38,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -451,3 +457,118 @@ int DNNL_API get_max_concurrency() {
 } // namespace impl
 } // namespace dnnl
 #endif
+
+namespace dnnl {
+namespace impl {
+namespace affinity_utils {
+
+namespace {
+struct thread_affinity_t {
+    // Holds the list while it is active, so that the stream affinity may be
+    // changed concurrently with the execution.
+    std::shared_ptr<const std::vector<int>> active_cores;
+    // Number of nested activations.
+    int depth = 0;
+    // Whether the outermost activation restricted the thread to the list.
+    bool is_restricted = false;
+    // Core the thread is pinned to by `bind_thread_to_cpu_affinity()`, -1 if
+    // the thread is not pinned to a single core.
+    int bound_core = -1;
+#if defined(__linux__)
+    bool has_saved_mask = false;
+    cpu_set_t saved_mask;
+#endif
+};
+
+thread_affinity_t &get_thread_affinity() {
+    thread_local thread_affinity_t affinity;
+    return affinity;
+}
+
+#if defined(__linux__)
+void save_mask(thread_affinity_t &affinity) {
+    if (affinity.has_saved_mask) return;
+    affinity.has_saved_mask = ::sched_getaffinity(0, sizeof(cpu_set_t),
+                                      &affinity.saved_mask)
+            == 0;
+}
+
+void restore_mask(thread_affinity_t &affinity) {
+    if (affinity.has_saved_mask)
+        ::sched_setaffinity(0, sizeof(cpu_set_t), &affinity.saved_mask);
+    affinity.has_saved_mask = false;
+    affinity.bound_core = -1;
+}
+
+bool set_mask(const int *cores, size_t ncores) {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (size_t i = 0; i < ncores; i++)
+        CPU_SET(cores[i], &mask);
+    return ::sched_setaffinity(0, sizeof(cpu_set_t), &mask) == 0;
+}
+#endif
+} // namespace
+
+bool DNNL_API activate_cpu_affinity(
+        const std::shared_ptr<const std::vector<int>> &cores) {
+    auto &affinity = get_thread_affinity();
+    if (affinity.depth++ > 0) return false;
+    if (!cores || cores->empty()) return false;
+
+    affinity.active_cores = cores;
+    affinity.is_restricted = false;
+#if defined(__linux__)
+    // A worker of a parallel region running with this list keeps its core.
+    if (affinity.bound_core != -1
+            && std::find(cores->begin(), cores->end(), affinity.bound_core)
+                    != cores->end())
+        return true;
+    // The thread may be left pinned by a parallel region of another stream,
+    // the original mask is brought back first to be the one saved.
+    restore_mask(affinity);
+    save_mask(affinity);
+    affinity.is_restricted = set_mask(cores->data(), cores->size());
+#endif
+    return true;
+}
+
+bool DNNL_API deactivate_cpu_affinity() {
+    auto &affinity = get_thread_affinity();
+    assert(affinity.depth > 0);
+    if (affinity.depth == 0 || --affinity.depth > 0) return false;
+    if (!affinity.active_cores) return false;
+
+    affinity.active_cores.reset();
+#if defined(__linux__)
+    if (affinity.is_restricted) restore_mask(affinity);
+#endif
+    affinity.is_restricted = false;
+    return true;
+}
+
+const std::vector<int> DNNL_API *get_active_cpu_affinity() {
+    return get_thread_affinity().active_cores.get();
+}
+
+void DNNL_API bind_thread_to_cpu_affinity(
+        const std::vector<int> *cores, int ithr) {
+#if defined(__linux__)
+    auto &affinity = get_thread_affinity();
+    if (!cores || cores->empty()) {
+        if (affinity.bound_core != -1) restore_mask(affinity);
+        return;
+    }
+    const int core = (*cores)[ithr % cores->size()];
+    if (affinity.bound_core == core) return;
+    save_mask(affinity);
+    if (set_mask(&core, 1)) affinity.bound_core = core;
+#else
+    UNUSED(cores);
+    UNUSED(ithr);
+#endif
+}
+
+} // namespace affinity_utils
+} // namespace impl
+} // namespace dnnl
@@ -33,6 +33,7 @@
 #include "oneapi/dnnl/dnnl_version_hash.h"
 
 #include "c_types_map.hpp"
+#include "huge_pages.hpp"
 #include "verbose.hpp"
 
 #include "batch_normalization_pd.hpp"
@@ -104,6 +105,10 @@ void print_header() noexcept {
                 dnnl_runtime2str(dnnl_version()->cpu_runtime),
                 dnnl_get_max_threads());
         verbose_printf("info,cpu,isa:%s\n", cpu::platform::get_isa_info());
+        if (get_huge_pages_mode() != huge_pages_mode::none)
+            verbose_printf("info,cpu,huge pages:%s,page size:%zu\n",
+                    dnnl_huge_pages_mode2str(get_huge_pages_mode()),
+                    get_huge_page_size(huge_pages_mode::any));
 #endif
         verbose_printf("info,gpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->gpu_runtime));
@@ -687,13 +692,18 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
 
     std::string empty_delim, attr_delim = "+";
 
-    // scratchpad and fpmath mode are not a part of
+    // scratchpad, huge pages and fpmath mode are not a part of
     // has_default_values(). Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         ss << field_delim()
            << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm);
     }
+    const huge_pages_mode_t &hpm = attr->huge_pages_mode_;
+    if (hpm != huge_pages_mode::any) {
+        ss << field_delim()
+           << "attr-huge-pages:" << dnnl_huge_pages_mode2str(hpm);
+    }
     const fpmath_t &fpm = attr->fpmath_;
     if (fpm.mode_ != fpmath_mode_t::dnnl_fpmath_mode_strict
             || fpm.apply_to_int_) {
@@ -117,6 +117,17 @@ void set_acl_threading() {
 #endif
 }
 
+void acl_update_thread_affinity() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // OMPScheduler runs its own parallel regions over the OpenMP team of the
+    // library, so the team is (un)pinned in advance with an empty region of
+    // the same size. The affinity of a thread persists between the regions.
+    const int nthr = (int)arm_compute::Scheduler::get().num_threads();
+    if (nthr > 1) parallel(nthr, [](int, int) {});
+#endif
+    // ThreadpoolScheduler pins its workers in run_workloads()
+}
+
 } // namespace acl_thread_utils
 
 } // namespace aarch64
@@ -47,6 +47,9 @@ void acl_set_tp_benchmark_scheduler();
 #endif
 // Set threading for ACL
 void set_acl_threading();
+// Pin the Compute Library threads to the CPU affinity active for the calling
+// thread, or give them their original affinity back if none is active
+void acl_update_thread_affinity();
 } // namespace acl_thread_utils
 
 } // namespace aarch64
@@ -120,8 +120,11 @@ void ThreadpoolScheduler::run_workloads(
             & dnnl::threadpool_interop::threadpool_iface::ASYNCHRONOUS;
     counting_barrier_t b;
     if (is_async) b.init(num_threads);
+    const std::vector<int> *cores
+            = affinity_utils::get_active_cpu_affinity();
     tp->parallel_for(num_threads, [&](int ithr, int nthr) {
         bool is_main = get_active_threadpool() == tp;
+        affinity_utils::bind_thread_to_cpu_affinity(cores, ithr);
         if (!is_main) activate_threadpool(tp);
         // Make ThreadInfo local to avoid race conditions
         ThreadInfo info;
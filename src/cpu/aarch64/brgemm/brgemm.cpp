@@ -244,12 +244,24 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
             && (!one_of(dt_d, data_type::f32))
             && (!one_of(dt_bias, data_type::undef, data_type::f32)))
         return status::unimplemented;
+    if ((brg->dt_a == data_type::f16 && brg->dt_b == data_type::f16)
+            && (!one_of(dt_d, data_type::f16, data_type::f32)
+                    || !one_of(dt_bias, data_type::undef, data_type::f16,
+                            data_type::f32)))
+        return status::unimplemented;
 
     brg->dt_d = dt_d;
     brg->typesize_D = types::data_type_size(brg->dt_d);
 
     if (brg->is_int8 || (brg->dt_d == bf16)) return status::unimplemented;
 
+    // f16 accumulation is allowed by the accumulation mode. It is only used
+    // by the kernels which start from zero accumulators, partial results
+    // accumulated through C are kept in f32.
+    brg->is_f16_acc = brg->is_f16 && brg->beta == 0.f && brg->attr
+            && one_of(brg->attr->acc_mode_, accumulation_mode::relaxed,
+                    accumulation_mode::any, accumulation_mode::f16);
+
     if (!brg->attr) return status::success;
 
     using namespace injector;
@@ -498,6 +510,7 @@ int brgemm_cmp(const brgemm_t &lhs, const brgemm_t &rhs) {
     CMP_BRGEMM_FIELD(is_dgmm);
     CMP_BRGEMM_FIELD(with_sum);
     CMP_BRGEMM_FIELD(req_cal_comp_pads);
+    CMP_BRGEMM_FIELD(is_f16_acc);
 
     CMP_BRGEMM_FIELD(sum_scale);
     CMP_BRGEMM_FIELD(sum_zp);
@@ -552,6 +565,7 @@ int brgemm_cmp(const brgemm_t &lhs, const brgemm_t &rhs) {
 
     CMP_BRGEMM_FIELD(brgattr.hint_load_nt_A);
     CMP_BRGEMM_FIELD(brgattr.hint_load_nt_B);
+    CMP_BRGEMM_FIELD(brgattr.hint_store_nt_D);
     CMP_BRGEMM_FIELD(brgattr.K_koef);
 
     if (lhs.brgattr.bd_mask_level > 0)
@@ -168,6 +168,8 @@ struct DNNL_API brgemm_attr_t {
 
     brgemm_kernel_hint_nt_t hint_load_nt_A {brgemm_hint_nt_undef};
     brgemm_kernel_hint_nt_t hint_load_nt_B {brgemm_hint_nt_undef};
+    // if true then the post-ops output D is written with non-temporal stores
+    bool hint_store_nt_D {false};
     // this variable is used in tile decomposition heuristics
     // to calculate "effective" K value which may be different from just
     // K * batch_size for non-1x1 convolutions due to data overlap
@@ -250,12 +252,18 @@ struct brgemm_t {
     int typesize_D = 0;
     int typesize_bias = 0;
 
+    bool is_xmm = false;
     bool is_ymm = false;
     bool is_zmm = false;
 
     bool is_int8 = false;
     bool is_bf16 = false, is_bf16_emu = false;
     bool is_f16 = false;
+    // f16 products are accumulated in f16 with FMLA (.h) and converted to
+    // f32 before the accumulators are stored. f16 values are kept unpacked in
+    // the low halves of the 32-bit lanes, so the blocking is the same as for
+    // f32 accumulation.
+    bool is_f16_acc = false;
 
     bool is_f32 = false;
     bool is_bf32 = false;
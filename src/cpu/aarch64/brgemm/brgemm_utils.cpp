@@ -100,12 +100,24 @@ status_t set_isa_impl(brgemm_t *brg) {
                 one_of(brg->isa_user, isa_undef, isa);
     };
 
-    if (brg->is_bf32 || brg->is_bf16 || brg->is_f16) {
+    if (brg->is_bf32 || brg->is_bf16) {
         return status::unimplemented;
-    } else if (brg->is_f32 || brg->is_int8) {
+    } else if (brg->is_f16) {
+        // f16 inputs are converted to f32 on the fly and accumulated in f32,
+        // mixed f16 / f32 inputs are not supported.
+        if (!everyone_is(data_type::f16, brg->dt_a, brg->dt_b))
+            return status::unimplemented;
+        brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
+                is_isa_ok(sve_256), sve_256, is_isa_ok(sve_128), sve_128);
+        return status::success;
+    } else if (brg->is_int8) {
         brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
                 is_isa_ok(sve_256), sve_256);
         return status::success;
+    } else if (brg->is_f32) {
+        brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
+                is_isa_ok(sve_256), sve_256, is_isa_ok(sve_128), sve_128);
+        return status::success;
     }
     return status::success;
 }
@@ -115,6 +127,8 @@ void set_brg_vmm(brgemm_t *brg) {
     brg->is_zmm = mayiuse(sve_512) && is_superset(brg->isa_impl, sve_512);
     brg->is_ymm = !brg->is_zmm && mayiuse(sve_256)
             && is_superset(brg->isa_impl, sve_256);
+    brg->is_xmm = !brg->is_zmm && !brg->is_ymm && mayiuse(sve_128)
+            && is_superset(brg->isa_impl, sve_128);
 }
 
 int calculate_ldb_params(brgemm_t *brg, const int try_ld_block2) {
@@ -190,20 +204,41 @@ status_t brgemm_blocking(brgemm_t *brg) {
     if (brg->isa_impl == isa_undef) return status::unimplemented;
     assert(!brg->is_dgmm); // should not be called from brdgmm
     set_brg_vmm(brg);
-    if (!(brg->is_zmm || brg->is_ymm)) return status::unimplemented;
+    if (!(brg->is_zmm || brg->is_ymm || brg->is_xmm))
+        return status::unimplemented;
 
-    const int simd_w = is_superset(brg->isa_impl, sve_512) ? 16 : 8;
+    const int simd_w = isa_max_vlen(brg->isa_impl) / sizeof(float);
     brg->ld_block = simd_w;
     brg->ldb = brg->load_dim / brg->ld_block;
     brg->ldb_tail = brg->load_dim % brg->ld_block;
 
-    int adj_ld_block2 = calculate_ldb_params(brg, 4);
+    int try_ld_block2 = 4;
+    if (brg->isa_impl == sve_128) {
+        // A 128-bit vector holds only 4 floats, so the microkernel is bound
+        // by the B loads and A broadcasts rather than by the FMAs. Pick the
+        // 'ld_block2' x 'bd_block' tile that maximizes FMAs per load within
+        // the 32 vector registers (5x5 when N allows it).
+        float best_ratio = 0.f;
+        for (int ld_block2 = 6; ld_block2 >= 2; ld_block2--) {
+            const int adj = calculate_ldb_params(brg, ld_block2);
+            if (adj != ld_block2) continue;
+            const int bd = calculate_max_bcast_block(brg, adj);
+            if (bd < 1) continue;
+            const float ratio = static_cast<float>(adj * bd) / (adj + bd);
+            if (ratio > best_ratio) {
+                best_ratio = ratio;
+                try_ld_block2 = ld_block2;
+            }
+        }
+    }
+
+    int adj_ld_block2 = calculate_ldb_params(brg, try_ld_block2);
     int max_bcast_block = calculate_max_bcast_block(brg, adj_ld_block2);
 
     // reduce 'ld_block2' to allow a larger 'bd_block'
     const int max_vpad = nstl::max(
             brg->brgattr.max_top_vpad, brg->brgattr.max_bottom_vpad);
-    if (is_superset(brg->isa_impl, sve_256) && max_bcast_block < max_vpad) {
+    if (is_superset(brg->isa_impl, sve_128) && max_bcast_block < max_vpad) {
         adj_ld_block2 = calculate_ldb_params(brg, 2);
         max_bcast_block = calculate_max_bcast_block(brg, adj_ld_block2);
     }
@@ -232,8 +267,7 @@ status_t brgemm_blocking(brgemm_t *brg) {
     brg->bdb_tail = brg->bcast_dim % brg->bd_block;
 
     const int rd_unroll = 4;
-    const int vnni_granularity = data_type_vnni_granularity(brg->dt_a);
-    brg->rd_block = rd_unroll * vnni_granularity;
+    brg->rd_block = rd_unroll * brg->rd_step;
     brg->rdb = brg->reduce_dim / brg->rd_block;
     brg->rdb_tail = brg->reduce_dim % brg->rd_block;
 
@@ -348,7 +382,9 @@ status_t init_brgemm_conf(brgemm_t *brg, cpu_isa_t isa,
     brg->ld_step
             = is_b_in_vnni_format ? data_type_vnni_granularity(brg->dt_b) : 1;
 
-    const bool has_no_vnni_compute_instruction = false;
+    // There is no f16 dot product instruction, f16 values are converted to
+    // f32 and accumulated one by one along the reduce dimension.
+    const bool has_no_vnni_compute_instruction = brg->is_f16;
     brg->rd_step = has_no_vnni_compute_instruction
             ? 1
             : data_type_vnni_granularity(brg->dt_b);
@@ -385,7 +421,7 @@ status_t init_brdgmm_conf(brgemm_t *brg, cpu_isa_t isa,
 
     if (brg->is_f32) {
         brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
-                is_isa_ok(sve_256), sve_256);
+                is_isa_ok(sve_256), sve_256, is_isa_ok(sve_128), sve_128);
     }
 
     brg->is_dgmm = true;
@@ -41,7 +41,7 @@ using namespace dnnl::impl::utils;
 jit_brdgmm_kernel_base_t::jit_brdgmm_kernel_base_t(const brgemm_t &abrd)
     : jit_generator(nullptr, MAX_CODE_SIZE, true, sve_512)
     , brg(abrd)
-    , simd_w_(cpu_isa_traits<sve_512>::vlen / brg.typesize_C) {
+    , simd_w_(isa_max_vlen(brg.isa_impl) / brg.typesize_C) {
 
     if (brg.with_eltwise || brg.with_binary || brg.with_sum) {
         static constexpr bool preserve_gpr = true;
@@ -839,7 +839,7 @@ void jit_brdgmm_kernel_base_t::compute_loop() {
 
         L(m_loop_label);
         {
-            if (reset_mask) { ptrue(k_mask.b); }
+            if (reset_mask) { mov(k_mask.b, P_ALL_ONE.b); }
             n_loop(m_blocks);
 
             if (do_loop_m || has_m_block2_tail) {
@@ -861,7 +861,7 @@ void jit_brdgmm_kernel_base_t::compute_loop() {
         }
 
         if (m_block2_tail() > 0) {
-            if (reset_mask) { ptrue(k_mask.b); }
+            if (reset_mask) { mov(k_mask.b, P_ALL_ONE.b); }
             n_loop(m_block2_tail());
         }
     };
@@ -886,13 +886,16 @@ void jit_brdgmm_kernel_base_t::init_masks() {
     } else if (brg.with_binary) {
         // the post-ops injector seems to use mask unconditionally
         // set a default mask.
-        ptrue(k_mask.b);
+        mov(k_mask.b, P_ALL_ONE.b);
     }
 }
 
 void jit_brdgmm_kernel_base_t::generate() {
 
     preamble();
+    const int vlen = isa_max_vlen(brg.isa_impl);
+    if (static_cast<uint64_t>(vlen) != cpu_sveLen)
+        set_preg(P_ALL_ONE.b, vlen, X_TMP_0, X_TMP_1);
     sub_imm(X_SP, X_SP, stack_space_needed_, X_TMP_0); //rsp=X_SP
 
     init_masks();
@@ -492,7 +492,10 @@ void jit_brgemm_kernel_t::load_data(data_type_t type_in,
         case data_type::s8:
         case data_type::u8: assert(!"unsupported\n"); break;
         case data_type::bf16: assert(!"unsupported\n"); break;
-        case data_type::f16: assert(!"unsupported\n"); break;
+        case data_type::f16:
+            ld1h(vmm.s, P_ALL_ONE / T_z, ptr(reg_addr));
+            fcvt(vmm.s, P_ALL_ONE / T_m, vmm.h);
+            break;
         default: assert(!"unsupported source data type");
     }
 }
@@ -508,12 +511,18 @@ void jit_brgemm_kernel_t::cvt2ps(data_type_t type_in, const ZReg zmm_in,
             if (store) //Merging
                 mov(zmm_in.s, ktail_mask / T_m, z_tmp_1().s);
             break;
+        case data_type::f16:
+            LD_MUL_VL(ld1h, z_tmp_1().s, mask, addr, offset - base_offset, 2);
+            fcvt(z_tmp_1().s, P_ALL_ONE / T_m, z_tmp_1().h);
+            if (store) //Merging
+                mov(zmm_in.s, ktail_mask / T_m, z_tmp_1().s);
+            break;
         case data_type::bf16: assert(!"unsupported data type\n"); break;
         case data_type::s8: assert(!"unsupported data type\n"); break;
         case data_type::u8: assert(!"unsupported data type\n"); break;
         default: assert(!"unsupported data type");
     }
-    if (!one_of(type_in, data_type::f32, data_type::bf16))
+    if (!one_of(type_in, data_type::f32, data_type::bf16, data_type::f16))
         assert(!"unsupported data type\n");
 }
 
@@ -881,7 +890,11 @@ void jit_brgemm_kernel_t::apply_post_ops(
                 const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
                 const auto k_mask = is_tail ? ld_tail_mask : ld_full_mask;
                 add_imm(X_DEFAULT_ADDR, reg_aux_D, D_offset(bd, ld), X_TMP_0);
-                ld1w(vmm_prev_dst.s, k_mask / T_z, ptr(X_DEFAULT_ADDR));
+                if (brg.sum_dt == data_type::f16) {
+                    ld1h(vmm_prev_dst.s, k_mask / T_z, ptr(X_DEFAULT_ADDR));
+                    fcvt(vmm_prev_dst.s, P_ALL_ONE / T_m, vmm_prev_dst.h);
+                } else
+                    ld1w(vmm_prev_dst.s, k_mask / T_z, ptr(X_DEFAULT_ADDR));
                 if (p_sum_zp_reg_set)
                     fsub(vmm_prev_dst.s, vmm_prev_dst.s, vmm_sum_zp.s);
                 if (p_sum_scale_reg_set) {
@@ -905,7 +918,7 @@ void jit_brgemm_kernel_t::apply_post_ops(
 }
 
 static inline bool isa_has_masks(cpu_isa_t isa) {
-    return is_superset(isa, sve_256);
+    return is_superset(isa, sve_128);
 }
 
 void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
@@ -1027,8 +1040,17 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
             switch (brg.dt_d) {
                 case data_type::f32:
                 case data_type::s32:
-                    ST_MUL_VL(st1w, zmm.s, k_mask, x_addr, offset - base_offset,
-                            4);
+                    if (brg.brgattr.hint_store_nt_D)
+                        ST_MUL_VL(stnt1w, zmm.s, k_mask, x_addr,
+                                offset - base_offset, 4)
+                    else
+                        ST_MUL_VL(st1w, zmm.s, k_mask, x_addr,
+                                offset - base_offset, 4)
+                    break;
+                case data_type::f16:
+                    fcvt(zmm.h, P_ALL_ONE / T_m, zmm.s);
+                    ST_MUL_VL(st1h, zmm.s, k_mask, x_addr, offset - base_offset,
+                            2);
                     break;
                 case data_type::bf16: assert(!"unsupported\n"); break;
                 case data_type::s8: assert(!"unsupported\n"); break;
@@ -1094,7 +1116,7 @@ void jit_brgemm_kernel_t::apply_compensation(
             auto vmm_comp = z_tmp_1();
             int comp_offset = compensations_offset(ld);
             const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
-            if (IMPLICATION(is_tail, is_superset(brg.isa_impl, sve_512))) {
+            if (IMPLICATION(is_tail, brg.isa_impl != sve_256)) {
                 const auto mask = is_tail ? k_mask : P_ALL_ONE;
                 ld1w(vmm_comp.s, mask / T_z,
                         ptr(reg_aux_compensation, comp_offset));
@@ -1157,6 +1179,14 @@ void jit_brgemm_kernel_t::store_accumulators(int bd_block2, bool is_bdb_tail,
         assert(!"unsupported\n");
     }
 
+    if (brg.is_f16_acc) {
+        for_(int bd = 0; bd < bd_block; bd++)
+        for (int ld = 0; ld < ld_block2; ld++) {
+            auto zmm = accm(ld_block2, bd, ld);
+            fcvt(zmm.s, P_ALL_ONE / T_m, zmm.h);
+        }
+    }
+
     if (need_to_apply_alpha_beta)
         apply_alpha_beta(bd_block, ld_block2, is_ld_tail);
 
@@ -1255,7 +1285,11 @@ void jit_brgemm_kernel_t::set_A_B_matrices() {
 }
 
 void jit_brgemm_kernel_t::dot_product(ZReg v1, ZReg v2, ZReg v3) {
-    if (brg.is_f32) {
+    // f16 operands are either accumulated in f16 in the low halves of the
+    // 32-bit lanes or converted to f32 when they are loaded
+    if (brg.is_f16_acc) {
+        fmla(v1.h, P_ALL_ONE / T_m, v2.h, v3.h);
+    } else if (brg.is_f32 || brg.is_f16) {
         fmla(v1.s, P_ALL_ONE / T_m, v2.s, v3.s);
     } else if (brg.is_bf16)
         assert(!"unsupported\n");
@@ -1379,7 +1413,14 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
             } else if (one_of(dt, data_type::s8, data_type::u8)) {
                 assert(!"unsupported\n");
             } else if (dt == data_type::f16) {
-                assert(!"unsupported\n");
+                if (offset < (1 << 7)) {
+                    ld1rh(z1.s, P_ALL_ONE / T_z,
+                            ptr(reg_aux_A, (int32_t)offset));
+                } else {
+                    add_imm(X_DEFAULT_ADDR, reg_aux_A, offset, X_TMP_0);
+                    ld1rh(z1.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+                }
+                if (!brg.is_f16_acc) fcvt(z1.s, P_ALL_ONE / T_m, z1.h);
             }
         }
 
@@ -1410,7 +1451,11 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
                 const auto addr = ptr(reg_aux_B, B_offset(ld, rd));
                 const auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
                 if (brg.dt_b == data_type::f16) {
-                    assert(!"unsupported\n");
+                    add_imm(X_DEFAULT_ADDR, reg_aux_B, B_offset(ld, rd),
+                            X_TMP_0);
+                    ld1h(load().s, mask / T_z, ptr(X_DEFAULT_ADDR));
+                    if (!brg.is_f16_acc)
+                        fcvt(load().s, P_ALL_ONE / T_m, load().h);
                 } else if (brg.dt_b == data_type::bf16
                         && brg.isa_impl == sve_256) {
                     assert(!"unsupported\n");
@@ -1445,7 +1490,16 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
             for (int ld = 0; ld < ld_block2; ld++) {
                 const auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
                 if (brg.dt_b == data_type::f16) {
-                    assert(!"unsupported\n");
+                    const int offset = B_offset(ld, rd);
+                    if ((unsigned)(offset - base_offset) > cpu_sveLen * 7) {
+                        add_imm(reg_tmp_, reg_aux_B, offset, X_TMP_0);
+                        base_offset = offset;
+                        x_addr = reg_tmp_;
+                    }
+                    LD_MUL_VL(ld1h, load(ld).s, mask, x_addr,
+                            offset - base_offset, 2);
+                    if (!brg.is_f16_acc)
+                        fcvt(load(ld).s, P_ALL_ONE / T_m, load(ld).h);
                 } else if (brg.dt_b == data_type::bf16
                         && brg.isa_impl == sve_256) {
                     assert(!"unsupported\n");
@@ -1855,6 +1909,9 @@ void jit_brgemm_kernel_t::generate() {
         case sve_256:
             simd_w_ = cpu_isa_traits<sve_256>::vlen / sizeof(float);
             break;
+        case sve_128:
+            simd_w_ = cpu_isa_traits<sve_128>::vlen / sizeof(float);
+            break;
         default: {
             assert(!"unsupported isa");
             return;
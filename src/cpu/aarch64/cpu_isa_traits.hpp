@@ -161,7 +161,7 @@ struct cpu_isa_traits<asimd> {
         static constexpr int n_vregs = 32; \
         static constexpr dnnl_cpu_isa_t user_option_val \
                 = static_cast<dnnl_cpu_isa_t>(dnnl_cpu_isa_sve_##bits); \
-        static constexpr const char *user_option_env = "sve_ ## bits"; \
+        static constexpr const char *user_option_env = "sve_" #bits; \
     };
 
 CPU_ISA_SVE(128, 4)
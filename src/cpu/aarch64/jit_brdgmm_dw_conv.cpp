@@ -657,6 +657,7 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::execute(
 }
 template struct brdgmm_dw_convolution_fwd_t<sve_512>;
 template struct brdgmm_dw_convolution_fwd_t<sve_256>;
+template struct brdgmm_dw_convolution_fwd_t<sve_128>;
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
@@ -56,6 +56,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
             | skip_mask_t::zero_points;
     if (one_of(src_type, u8, s8)) skip_mask |= skip_mask_t::scales;
+    // f16 may be accumulated in f16, see brgemm_t::is_f16_acc
+    if (src_type == f16) skip_mask |= skip_mask_t::accumulation_mode;
 
     bool ok = is_fwd() && set_default_alg_kind(alg_kind::convolution_direct)
             && expect_data_types(src_type, wei_type, data_type::undef, dst_type,
@@ -163,9 +165,10 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
     dst_h_sz = OH * dst_w_sz;
     dst_d_sz = OD * dst_h_sz;
 
-    const auto src_type = pd()->src_md(0)->data_type;
+    const auto wei_type = pd()->weights_md(0)->data_type;
 
-    const auto last_ic_block = data_type_vnni_granularity(src_type);
+    const auto last_ic_block
+            = brgemm_convolution_utils::get_wei_vnni_granularity(wei_type);
 
     wei_ic_stride = jcp.wei_plain ? jcp.oc_without_padding : jcp.oc_block;
     wei_ocb_stride = jcp.wei_plain
@@ -556,6 +559,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
 
 template struct brgemm_1x1_convolution_fwd_t<sve_512>;
 template struct brgemm_1x1_convolution_fwd_t<sve_256>;
+template struct brgemm_1x1_convolution_fwd_t<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
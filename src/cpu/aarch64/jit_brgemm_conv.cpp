@@ -313,6 +313,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
             | skip_mask_t::zero_points;
     if (is_int8) skip_mask |= skip_mask_t::scales;
+    // f16 may be accumulated in f16, see brgemm_t::is_f16_acc
+    if (src_type == f16) skip_mask |= skip_mask_t::accumulation_mode;
 
     bool ok = is_fwd() && set_default_alg_kind(alg_kind::convolution_direct)
             && IMPLICATION(is_int8,
@@ -2026,6 +2028,7 @@ void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
 #undef BRGEMM_CONV_KER_HEADER
 template struct brgemm_convolution_fwd_t<sve_512>;
 template struct brgemm_convolution_fwd_t<sve_256>;
+template struct brgemm_convolution_fwd_t<sve_128>;
 
 } // namespace aarch64
 
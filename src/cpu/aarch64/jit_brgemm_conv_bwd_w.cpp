@@ -0,0 +1,325 @@
+/*******************************************************************************
+* Copyright 2022-2023 Intel Corporation
+* Copyright 2024 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/aarch64/jit_brgemm_conv_bwd_w.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using namespace nstl;
+using namespace data_type;
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::pd_t::init(engine_t *engine) {
+    bool ok = desc()->prop_kind == prop_kind::backward_weights
+            && set_default_alg_kind(alg_kind::convolution_direct)
+            && expect_data_types(f32, f32, data_type::undef, f32, f32)
+            && one_of(diff_bias_md_.data_type, data_type::undef, f32)
+            && attr()->has_default_values() && !has_zero_dim_memory()
+            && impl::is_dense_format_kind(
+                    {src_md(), diff_weights_md(), diff_dst_md()});
+    if (!ok) return status::unimplemented;
+
+    CHECK(brgemm_convolution_utils::init_conf_bwd_w(jcp_, isa, *desc(),
+            src_md_, diff_weights_md_, diff_bias_md_, diff_dst_md_, attr_,
+            dnnl_get_max_threads()));
+
+    brgs_ = std::make_shared<brgemm_containers::brgemm_desc_container_t>(4);
+
+    // diff_weights are zeroed before the computations so all the kernels
+    // accumulate into them.
+    const float alpha = 1.0;
+    const float beta = 1.0;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const auto vM = (i_M) ? jcp_.M_tail : jcp_.M;
+        const auto vN = (i_N) ? jcp_.N_tail : jcp_.N;
+        if (vM == 0 || vN == 0) continue;
+        brgemm_t brg;
+        CHECK(brgemm_desc_init(&brg, isa, jcp_.brg_type, f32, f32, false,
+                false, brgemm_row_major, alpha, beta, jcp_.LDA, jcp_.LDB,
+                jcp_.LDC, vM, vN, jcp_.K, nullptr));
+        CHECK(brgemm_desc_finalize(&brg));
+        brgs_->insert(get_brg_idx(i_M, i_N), brg);
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    return brgemm_convolution_utils::init_scratchpad_bwd_w(
+            scratchpad, jcp_, src_md_, diff_weights_md_, diff_dst_md_);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::init(engine_t *engine) {
+    const auto &brgs = *(pd()->brgs_);
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const auto brg_idx = get_brg_idx(i_M, i_N);
+        const auto brg = brgs[brg_idx];
+        if (brg != nullptr && brg->bcast_dim > 0 && brg->load_dim > 0
+                && brg->reduce_dim > 0 && !brg_kernels_[brg_idx]) {
+            CHECK(brg_kernels_.insert(brg_idx, brg));
+        }
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::compute_diff_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_weights = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *tr_src_global = scratchpad.template get<float>(key_conv_tr_src);
+    brgemm_batch_element_t *brg_batch_global
+            = scratchpad.template get<brgemm_batch_element_t>(
+                    key_brgemm_primitive_batch);
+    float *wei_reduction
+            = scratchpad.template get<float>(key_conv_wei_bia_reduction);
+
+    const dim_t G = jcp.ngroups;
+    const dim_t IC = jcp.ic;
+    const dim_t OC = jcp.oc;
+    const dim_t src_c_sz = G * jcp.ic_without_padding;
+    const dim_t dst_c_sz = G * jcp.oc_without_padding;
+    const dim_t wei_size = G * OC * IC * jcp.kd * jcp.kh * jcp.kw;
+
+    // offsets in plain "spatial x ic x g x oc" diff_weights
+    auto wei_off = [&](dim_t g, int kd, int kh, int kw, dim_t ic, dim_t oc) {
+        return ((((kd * jcp.kh + kh) * jcp.kw + kw) * IC + ic) * G + g) * OC
+                + oc;
+    };
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        assert(nthr == jcp.nthr);
+        MAYBE_UNUSED(nthr);
+
+        const int ithr_ic_b = ithr % jcp.nthr_ic_b;
+        const int ithr_oc_b = ithr / jcp.nthr_ic_b % jcp.nthr_oc_b;
+        const int ithr_g = ithr / jcp.nthr_ic_b / jcp.nthr_oc_b % jcp.nthr_g;
+        const int ithr_mb = ithr / jcp.nthr_ic_b / jcp.nthr_oc_b / jcp.nthr_g;
+        if (ithr_mb >= jcp.nthr_mb) return;
+
+        int g_s {0}, g_e {0}, icb_s {0}, icb_e {0}, ocb_s {0}, ocb_e {0};
+        int work_s {0}, work_e {0};
+        balance211(jcp.ngroups, jcp.nthr_g, ithr_g, g_s, g_e);
+        balance211(jcp.nb_ic, jcp.nthr_ic_b, ithr_ic_b, icb_s, icb_e);
+        balance211(jcp.nb_oc, jcp.nthr_oc_b, ithr_oc_b, ocb_s, ocb_e);
+        balance211(jcp.nthr_mb_work, jcp.nthr_mb, ithr_mb, work_s, work_e);
+
+        float *wei = ithr_mb == 0 ? diff_weights
+                                  : wei_reduction + (ithr_mb - 1) * wei_size;
+
+        // zero the part of diff_weights (or of the reduction buffer) owned
+        // by this thread
+        const dim_t oc_s = (dim_t)ocb_s * jcp.oc_block;
+        const dim_t oc_e = nstl::min((dim_t)ocb_e * jcp.oc_block, OC);
+        const dim_t ic_s = (dim_t)icb_s * jcp.ic_block;
+        const dim_t ic_e = nstl::min((dim_t)icb_e * jcp.ic_block, IC);
+        if (oc_s < oc_e) {
+            for_(dim_t g = g_s; g < g_e; g++)
+            for_(int kd = 0; kd < jcp.kd; kd++)
+            for_(int kh = 0; kh < jcp.kh; kh++)
+            for_(int kw = 0; kw < jcp.kw; kw++)
+            for (dim_t ic = ic_s; ic < ic_e; ic++)
+                std::memset(&wei[wei_off(g, kd, kh, kw, ic, oc_s)], 0,
+                        (oc_e - oc_s) * sizeof(float));
+        }
+        if (work_s >= work_e) return;
+
+        float *tr_src = tr_src_global + (size_t)ithr * jcp.tr_src_buf_size;
+        brgemm_batch_element_t *brg_batch
+                = brg_batch_global + (size_t)ithr * jcp.adjusted_batch_size;
+        std::vector<const float *> dst_rows(jcp.oh_block);
+
+        for_(dim_t g = g_s; g < g_e; g++)
+        for_(int icb = icb_s; icb < icb_e; icb++)
+        for (int work = work_s; work < work_e; work++) {
+            const int n = work / jcp.od;
+            const int od = work % jcp.od;
+            const dim_t ic = (dim_t)icb * jcp.ic_block;
+            const bool is_M_tail = IC - ic < jcp.ic_block;
+            const int cur_ic_block = is_M_tail ? jcp.M_tail : jcp.M;
+
+            for_(int kd = 0; kd < jcp.kd; kd++)
+            for (int ohb = 0; ohb < jcp.oh; ohb += jcp.oh_block) {
+                const int id = od * jcp.stride_d + kd * (jcp.dilate_d + 1)
+                        - jcp.f_pad;
+                if (id < 0 || id >= jcp.id) continue;
+                const int oh_e = nstl::min(ohb + jcp.oh_block, jcp.oh);
+
+                // transpose the source rows used by the oh block once for all
+                // the kernel points, the padded area is filled with zeros
+                const int ih_s = ohb * jcp.stride_h - jcp.t_pad;
+                const int tr_ih = (oh_e - 1 - ohb) * jcp.stride_h
+                        + (jcp.kh - 1) * (jcp.dilate_h + 1) + 1;
+                for (int ih_l = 0; ih_l < tr_ih; ih_l++) {
+                    const int ih = ih_s + ih_l;
+                    if (ih < 0 || ih >= jcp.ih) continue;
+
+                    const float *src_row = src
+                            + ((n * jcp.id + id) * (dim_t)jcp.ih + ih) * jcp.iw
+                                    * src_c_sz
+                            + g * jcp.ic_without_padding + ic;
+                    for (int r = 0; r < jcp.stride_w; r++) {
+                        float *A = tr_src
+                                + ((size_t)ih_l * jcp.stride_w + r)
+                                        * jcp.ic_block * jcp.LDA;
+                        for (int j = 0; j < jcp.tr_iw; j++) {
+                            const int iw = j * jcp.stride_w + r - jcp.l_pad;
+                            const bool is_pad = iw < 0 || iw >= jcp.iw;
+                            for (int icc = 0; icc < cur_ic_block; icc++)
+                                A[icc * jcp.LDA + j] = is_pad
+                                        ? 0.f
+                                        : src_row[iw * src_c_sz + icc];
+                        }
+                    }
+                }
+
+                for_(int kh = 0; kh < jcp.kh; kh++)
+                for (int kw = 0; kw < jcp.kw; kw++) {
+                    // the columns read by the kernel point are contiguous in
+                    // the phase of its offset
+                    const int kw_off = kw * (jcp.dilate_w + 1);
+                    const int r = kw_off % jcp.stride_w;
+                    const int j_s = kw_off / jcp.stride_w;
+                    int bs = 0;
+                    for (int oh = ohb; oh < oh_e; oh++) {
+                        const int ih = oh * jcp.stride_h
+                                + kh * (jcp.dilate_h + 1) - jcp.t_pad;
+                        if (ih < 0 || ih >= jcp.ih) continue;
+
+                        const float *A = tr_src
+                                + ((size_t)(ih - ih_s) * jcp.stride_w + r)
+                                        * jcp.ic_block * jcp.LDA
+                                + j_s;
+                        dst_rows[bs] = diff_dst
+                                + ((n * jcp.od + od) * (dim_t)jcp.oh + oh)
+                                        * jcp.ow * dst_c_sz
+                                + g * jcp.oc_without_padding;
+                        brg_batch[bs].ptr.A = A;
+                        bs++;
+                    }
+                    if (bs == 0) continue;
+
+                    for (int ocb = ocb_s; ocb < ocb_e; ocb++) {
+                        const dim_t oc = (dim_t)ocb * jcp.oc_block;
+                        const bool is_N_tail = OC - oc < jcp.oc_block;
+                        for (int i = 0; i < bs; i++)
+                            brg_batch[i].ptr.B = dst_rows[i] + oc;
+
+                        const auto brg_idx = get_brg_idx(is_M_tail, is_N_tail);
+                        float *C = &wei[wei_off(g, kd, kh, kw, ic, oc)];
+                        brgemm_kernel_execute(
+                                brg_kernels_[brg_idx], bs, brg_batch, C);
+                    }
+                }
+            }
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::reduce_diff_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+    if (jcp.nthr_mb <= 1) return;
+
+    auto diff_weights = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const float *wei_reduction
+            = scratchpad.template get<float>(key_conv_wei_bia_reduction);
+    const dim_t wei_size = (dim_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kd
+            * jcp.kh * jcp.kw;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(wei_size, nthr, ithr, start, end);
+        for (int i = 0; i < jcp.nthr_mb - 1; i++) {
+            const float *part = wei_reduction + i * wei_size;
+            PRAGMA_OMP_SIMD()
+            for (dim_t e = start; e < end; e++)
+                diff_weights[e] += part[e];
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+    if (!jcp.with_bias) return;
+
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
+
+    const dim_t dst_c_sz = (dim_t)jcp.ngroups * jcp.oc_without_padding;
+    const dim_t sp = (dim_t)jcp.mb * jcp.od * jcp.oh * jcp.ow;
+
+    parallel_nd(jcp.ngroups, jcp.nb_oc, [&](dim_t g, dim_t ocb) {
+        const dim_t oc = ocb * jcp.oc_block;
+        const dim_t cur_oc_block = nstl::min((dim_t)jcp.oc_block, jcp.oc - oc);
+        float *db = diff_bias + g * jcp.oc + oc;
+        const float *dd = diff_dst + g * jcp.oc_without_padding + oc;
+        for (dim_t o = 0; o < cur_oc_block; o++)
+            db[o] = 0.f;
+        for (dim_t s = 0; s < sp; s++) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t o = 0; o < cur_oc_block; o++)
+                db[o] += dd[s * dst_c_sz + o];
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::execute_backward_weights(
+        const exec_ctx_t &ctx) const {
+    compute_diff_weights(ctx);
+    reduce_diff_weights(ctx);
+    compute_diff_bias(ctx);
+}
+
+template struct brgemm_convolution_bwd_weights_t<sve_512>;
+template struct brgemm_convolution_bwd_weights_t<sve_256>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2022-2023 Intel Corporation
+* Copyright 2024 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_CONV_BWD_W_HPP
+#define CPU_AARCH64_JIT_BRGEMM_CONV_BWD_W_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#include "cpu/aarch64/brgemm/brgemm_containers.hpp"
+#include "cpu/aarch64/jit_brgemm_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Backward by weights convolution based on brgemm kernels. For every kernel
+// point the diff_weights are computed as a batch of
+// diff_weights[ic][oc] += src^T[ic][ow] * diff_dst[ow][oc] over the output
+// rows, where the source rows are transposed into a per thread buffer. The
+// work is split across the minibatch as well, in which case the partial
+// diff_weights are reduced in parallel at the end of the execution.
+template <cpu_isa_t isa>
+struct brgemm_convolution_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_weights_pd_t {
+        using cpu_convolution_bwd_weights_pd_t::
+                cpu_convolution_bwd_weights_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_bwd_w:", isa, ""),
+                brgemm_convolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<brgemm_containers::brgemm_desc_container_t> brgs_;
+
+        jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
+    };
+
+    brgemm_convolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~brgemm_convolution_bwd_weights_t() {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward_weights(ctx);
+        return status::success;
+    }
+
+protected:
+    status_t init(engine_t *engine) override;
+
+private:
+    void compute_diff_weights(const exec_ctx_t &ctx) const;
+    void reduce_diff_weights(const exec_ctx_t &ctx) const;
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+    void execute_backward_weights(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    static int get_brg_idx(bool is_M_tail, bool is_N_tail) {
+        return (int)is_M_tail * 2 + (int)is_N_tail;
+    }
+
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {4};
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -298,6 +298,7 @@ void jit_uni_brgemm_conv_comp_pad_kernel_t<isa>::generate() {
 
 template struct jit_uni_brgemm_conv_comp_pad_kernel_t<sve_512>;
 template struct jit_uni_brgemm_conv_comp_pad_kernel_t<sve_256>;
+template struct jit_uni_brgemm_conv_comp_pad_kernel_t<sve_128>;
 } // namespace jit_uni_brgemm_conv_comp_pad_kernel
 
 } // namespace aarch64
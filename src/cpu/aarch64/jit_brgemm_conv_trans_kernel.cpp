@@ -44,7 +44,7 @@ jit_sve_core_brgemm_conv_trans_kernel_t::
     dst_w_offset = jcp.kh_sets * jcp.kw_sets * ic_block_sz;
     dst_h_offset = dst_stride * dst_w_offset;
     iw_size = inp_dsz * jcp.ngroups * jcp.ic_without_padding;
-    VL = cpu_isa_traits<sve_512>::vlen;
+    VL = isa_max_vlen(jcp.isa);
     n_vec = jcp.ic_block / jcp.simd_w;
     n_tail_vec = (jcp.ic_without_padding % jcp.ic_block) / jcp.simd_w;
 }
@@ -81,11 +81,11 @@ int jit_sve_core_brgemm_conv_trans_kernel_t::inp_w_start(int owb) const {
     return get_inp_start(owb, jcp.ow_block, jcp.stride_w, jcp.l_pad);
 }
 
-// use different vmovdqu32/16/8 due to case when tail mask used
+// full vector moves are predicated to the vector length of jcp.isa
 void jit_sve_core_brgemm_conv_trans_kernel_t::load(
         const ZReg &x, const AdrNoOfs &addr) {
     if (one_of(jcp.src_dt, f32, s32))
-        ldr(QReg(x.getIdx()), addr);
+        ld1w(x.s, P_ALL_ONE / T_z, addr);
     else if (one_of(jcp.src_dt, bf16, f16)) {
         assert(!"Unknown type!\n");
     } else if (one_of(jcp.src_dt, data_type::s8, data_type::u8)) {
@@ -98,7 +98,7 @@ void jit_sve_core_brgemm_conv_trans_kernel_t::load(
 void jit_sve_core_brgemm_conv_trans_kernel_t::load(
         const ZReg &x, const PReg &p, const AdrNoOfs &addr) {
     if (one_of(jcp.src_dt, f32, s32)) {
-        ld1rw(x.s, p, addr);
+        ld1w(x.s, p / T_z, addr);
     } else if (one_of(jcp.src_dt, bf16, f16)) {
         assert(!"Unknown type!");
     } else if (one_of(jcp.src_dt, data_type::s8, data_type::u8)) {
@@ -110,7 +110,7 @@ void jit_sve_core_brgemm_conv_trans_kernel_t::load(
 void jit_sve_core_brgemm_conv_trans_kernel_t::store(
         const AdrNoOfs &addr, const ZReg &x) {
     if (one_of(jcp.src_dt, f32, s32))
-        str(QReg(x.getIdx()), addr);
+        st1w(x.s, P_ALL_ONE, addr);
     else if (one_of(jcp.src_dt, bf16, f16))
         assert(!"Unknown type!");
     else if (one_of(jcp.src_dt, data_type::s8, data_type::u8))
@@ -123,7 +123,7 @@ void jit_sve_core_brgemm_conv_trans_kernel_t::store(
 void jit_sve_core_brgemm_conv_trans_kernel_t::store(
         const AdrNoOfs &addr, const PReg &p, const ZReg &x) {
     if (one_of(jcp.src_dt, f32, s32)) {
-        st1w(zmm_zero.s, p, addr);
+        st1w(x.s, p, addr);
     } else if (one_of(jcp.src_dt, bf16, f16))
         assert(!"Unknown type!");
     else if (one_of(jcp.src_dt, data_type::s8, data_type::u8))
@@ -204,6 +204,8 @@ void jit_sve_core_brgemm_conv_trans_kernel_t::generate() {
     ldr(reg_ic, ptr(param1, uint32_t(GET_OFF(ic))));
 
     eor(zmm_zero.d, zmm_zero.d, zmm_zero.d);
+    if (static_cast<uint64_t>(VL) != cpu_sveLen)
+        set_preg(P_ALL_ONE.b, VL, X_TMP_0, X_TMP_1);
 
     if (jcp.ic_without_padding % jcp.ic_block) {
         int tail_size = (jcp.ic_without_padding % jcp.ic_block) % jcp.simd_w;
@@ -454,6 +456,8 @@ void jit_sve_core_brgemm_conv_rtus_kernel_t::generate() {
     ldr(reg_khp, ptr(X_DEFAULT_ADDR));
     add_imm(X_DEFAULT_ADDR, param1, GET_OFF(owb), X_TMP_0);
     ldr(reg_kwp, ptr(X_DEFAULT_ADDR));
+    if (static_cast<uint64_t>(VL) != cpu_sveLen)
+        set_preg(P_ALL_ONE.b, VL, X_TMP_0, X_TMP_1);
 
     if (jcp.ic_without_padding % jcp.ic_block) {
         int tail_size = (jcp.ic_without_padding % jcp.ic_block) % jcp.simd_w;
@@ -61,7 +61,7 @@ namespace brgemm_convolution_utils {
 bool is_any_eligible(const jit_brgemm_conv_conf_t &jcp) {
     return (jcp.prop_kind == prop_kind::forward_inference || jcp.wei_plain
             || one_of(jcp.wei_dt, data_type::s8, data_type::f16)
-            || one_of(jcp.isa, sve_512, sve_256));
+            || one_of(jcp.isa, sve_512, sve_256, sve_128));
 }
 
 inline status_t init_tag(format_tag_t &tag, memory_desc_t &md,
@@ -84,6 +84,10 @@ inline status_t init_tag(format_tag_t &tag, memory_desc_t &md,
     return status::success;
 }
 
+int get_wei_vnni_granularity(data_type_t wei_dt) {
+    return wei_dt == f16 ? 1 : data_type_vnni_granularity(wei_dt);
+}
+
 bool uses_batch_elements(
         brgemm_batch_kind_t brg_type, conv_brgemm_exec_type_t exec_type) {
     // Batch elements are required for all batch kinds except fixed strides.
@@ -127,7 +131,7 @@ status_t pick_tags(jit_brgemm_conv_conf_t &jcp, memory_desc_t &src_md,
     const memory_desc_wrapper dst_d(&dst_md);
     const memory_desc_wrapper bias_d(&bias_md);
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
-    const int vnni_granularity = data_type_vnni_granularity(jcp.wei_dt);
+    const int vnni_granularity = get_wei_vnni_granularity(jcp.wei_dt);
 
     const bool is_1d = jcp.ndims == 3;
     const bool is_2d = jcp.ndims == 4;
@@ -460,6 +464,15 @@ status_t pick_tags(jit_brgemm_conv_conf_t &jcp, memory_desc_t &src_md,
                     default: return status::unimplemented;
                 }
             }
+        } else if (jcp.oc_block == 4) {
+            // sve_128 only, f32 and f16 weights are not vnni-packed
+            if (vnni_granularity != 1) return status::unimplemented;
+            if (is_3d)
+                wei_tag = with_groups ? gOdhwi4o : Odhwi4o;
+            else if (is_1d)
+                wei_tag = with_groups ? gOwi4o : Owi4o;
+            else
+                wei_tag = with_groups ? gOhwi4o : Ohwi4o;
         } else {
             return status::unimplemented;
         }
@@ -834,6 +847,9 @@ bool brg_blocking_t::fast_check_oc_block() const {
                 = id * ih * iw > 81 * stride_d * stride_h * stride_w;
         res = (rnd_oc % oc_block == 0 && rnd_oc * wei_dsz <= 384 * 4
                 && big_spatial);
+    } else if (oc_block == 12) {
+        // there are no 12o weights layouts, skip it for sve_128 blocking
+        res = false;
     } else
         res = true;
 
@@ -1243,6 +1259,9 @@ bool brg_blocking_t::fast_check_oc_block_1x1() const {
     } else if (oc_block == 48) {
         const auto oc_block_eff = static_cast<float>(oc) / rnd_up(oc, oc_block);
         res = (oc_block_eff >= 0.95f);
+    } else if (oc_block == 12) {
+        // there are no 12o weights layouts, skip it for sve_128 blocking
+        res = false;
     } else
         res = true;
 
@@ -1712,7 +1731,7 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         }
     }
 
-    brg_blocking_t::last_ic_block_size = data_type_vnni_granularity(jcp.wei_dt);
+    brg_blocking_t::last_ic_block_size = get_wei_vnni_granularity(jcp.wei_dt);
 
     // TODO: optimize depthwise convolutions (for now direct approach is faster)
     const bool is_depthwise
@@ -1736,16 +1755,16 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.s8s8_compensation_required = is_signed_input && !isa_has_s8s8(jcp.isa);
     jcp.has_int8_vnni
             = is_superset(jcp.isa, sve_512) || is_superset(jcp.isa, sve_256);
-    if (!IMPLICATION(
-                jcp.wei_dt == s8, mayiuse(sve_512) || one_of(jcp.isa, sve_256)))
+    if (!IMPLICATION(jcp.wei_dt == s8, is_superset(jcp.isa, sve_256)))
         return status::unimplemented;
     if (!IMPLICATION(jcp.wei_dt == bf16, mayiuse(sve_256)))
         return status::unimplemented;
-    if (!IMPLICATION(jcp.wei_dt == f16, mayiuse(sve_256)))
+    if (!IMPLICATION(jcp.wei_dt == f16, mayiuse(sve_128)))
         return status::unimplemented;
     const bool is_f32
             = utils::everyone_is(f32, jcp.src_dt, jcp.wei_dt, jcp.dst_dt);
-    if (!IMPLICATION(is_f32, one_of(isa, sve_512, sve_256) || jcp.is_bf32))
+    if (!IMPLICATION(is_f32,
+                one_of(isa, sve_512, sve_256, sve_128) || jcp.is_bf32))
         return status::unimplemented;
 
     if (!post_ops_ok(jcp, attr, dst_d)) return status::unimplemented;
@@ -1913,7 +1932,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         // keep it memory
         if (jcp.loop_order == loop_ndhwgc) { jcp.copy_block_only = true; }
 
-        jcp.is_ic_padded = one_of(jcp.wei_dt, bf16, f16, s8)
+        jcp.is_ic_padded = one_of(jcp.wei_dt, bf16, s8)
                 && jcp.ic * jcp.kw_sets > ic_padded_block;
 
         try_exec_type_res = try_exec_type();
@@ -2114,6 +2133,9 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     }
     best_brgb.save_to_jcp(jcp);
 
+    // The rtus kernel doesn't support f16 yet
+    if (jcp.is_rtus && jcp.src_dt == f16) return status::unimplemented;
+
     // =============== end blocking =================================
     jcp.brg_stride_a = jcp.ic_block * jcp.src_dsz;
     jcp.brg_stride_b = jcp.ic_block * jcp.oc_without_padding * jcp.wei_dsz;
@@ -2411,7 +2433,7 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
     jcp.nthr_ic_b = nthr_ic_b;
 }
 
-status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
+status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
         memory_desc_t &diff_dst_md, primitive_attr_t &attr, int nthreads) {
@@ -2421,7 +2443,121 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
     const memory_desc_wrapper diff_dst_d(&diff_dst_md);
     const memory_desc_wrapper diff_bias_d(&diff_bias_md);
 
-    return status::unimplemented;
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    const bool with_groups = diff_weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+
+    jcp = zero<decltype(jcp)>();
+    jcp.isa = isa;
+    jcp.nthr = nthreads;
+    jcp.ndims = ndims;
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ngroups = with_groups ? diff_weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc_without_padding = diff_dst_d.dims()[1] / jcp.ngroups;
+    jcp.oc = jcp.oc_without_padding;
+    jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
+    jcp.ic = jcp.ic_without_padding;
+    jcp.id = (ndims == 5) ? src_d.dims()[2] : 1;
+    jcp.ih = (ndims == 3) ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = (ndims == 5) ? diff_dst_d.dims()[2] : 1;
+    jcp.oh = (ndims == 3) ? 1 : diff_dst_d.dims()[ndims - 2];
+    jcp.ow = diff_dst_d.dims()[ndims - 1];
+    jcp.kd = (ndims == 5) ? diff_weights_d.dims()[with_groups + 2] : 1;
+    jcp.kh = (ndims == 3) ? 1 : diff_weights_d.dims()[with_groups + ndims - 2];
+    jcp.kw = diff_weights_d.dims()[with_groups + ndims - 1];
+    jcp.f_pad = (ndims == 5) ? cd.padding[0][0] : 0;
+    jcp.t_pad = (ndims == 3) ? 0 : cd.padding[0][ndims - 4];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.stride_d = (ndims == 5) ? cd.strides[0] : 1;
+    jcp.stride_h = (ndims == 3) ? 1 : cd.strides[ndims - 4];
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.dilate_d = (ndims == 5) ? cd.dilates[0] : 0;
+    jcp.dilate_h = (ndims == 3) ? 0 : cd.dilates[ndims - 4];
+    jcp.dilate_w = cd.dilates[ndims - 3];
+
+    jcp.with_bias = cd.diff_bias_desc.format_kind != format_kind::undef;
+
+    jcp.src_dt = src_d.data_type();
+    jcp.dst_dt = diff_dst_d.data_type();
+    jcp.wei_dt = diff_weights_d.data_type();
+    jcp.bia_dt = jcp.with_bias ? diff_bias_d.data_type() : data_type::undef;
+
+    // Only f32 is supported: the transposed source buffer is prepared in
+    // plain C++ and consumed directly by the f32 brgemm kernels.
+    const bool is_f32 = everyone_is(f32, jcp.src_dt, jcp.dst_dt, jcp.wei_dt)
+            && IMPLICATION(jcp.with_bias, jcp.bia_dt == f32);
+    if (!is_f32) return status::unimplemented;
+    if (!attr.has_default_values()) return status::unimplemented;
+
+    jcp.src_dsz = types::data_type_size(jcp.src_dt);
+    jcp.wei_dsz = types::data_type_size(jcp.wei_dt);
+    jcp.bia_dsz = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+    jcp.acc_dt = f32;
+    jcp.acc_dsz = types::data_type_size(jcp.acc_dt);
+
+    // Source and diff_dst must be in channels last layout: the rows of
+    // diff_dst are used as is by the brgemm kernel and the rows of source are
+    // transposed into a per thread buffer. diff_weights are in plain
+    // "spatial x ic x oc" layout so that they are the brgemm C matrix.
+    const auto nxc_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const auto wei_tag = with_groups ? pick(ndims - 3, wigo, hwigo, dhwigo)
+                                     : pick(ndims - 3, wio, hwio, dhwio);
+    CHECK(init_tag(jcp.src_tag, src_md, src_d, nxc_tag, true));
+    CHECK(init_tag(jcp.dst_tag, diff_dst_md, diff_dst_d, nxc_tag, true));
+    CHECK(init_tag(
+            jcp.wei_tag, diff_weights_md, diff_weights_d, wei_tag, true));
+    if (jcp.with_bias && diff_bias_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md, x));
+    jcp.wei_plain = true;
+
+    const int simd_w = isa_max_vlen(isa) / sizeof(float);
+    jcp.simd_w = simd_w;
+    jcp.oc_block = 4 * simd_w;
+    jcp.nb_oc = div_up(jcp.oc, jcp.oc_block);
+    jcp.ic_block = nstl::min(jcp.ic, 16);
+    jcp.nb_ic = div_up(jcp.ic, jcp.ic_block);
+    jcp.nb_oc_blocking = jcp.nb_ic_blocking = 1;
+
+    // For every kernel point: C[ic][oc] += sum_oh sum_ow A[ic][ow] * B[ow][oc]
+    // where A is the transposed source and B is diff_dst.
+    jcp.brg_type = brgemm_addr;
+    jcp.M = jcp.ic_block;
+    jcp.M_tail = jcp.ic % jcp.ic_block;
+    jcp.N = jcp.oc_block;
+    jcp.N_tail = jcp.oc % jcp.oc_block;
+    // The source rows of an oh block are transposed once and shared by all
+    // the kernel points. Columns are split by their phase modulo stride_w so
+    // that the A matrix of every kernel point is a contiguous range of
+    // columns of one phase.
+    jcp.tr_iw = jcp.ow + (jcp.kw - 1) * (jcp.dilate_w + 1) / jcp.stride_w;
+    jcp.tr_ow = jcp.ow;
+    jcp.K = jcp.ow;
+    jcp.K_tail = 0;
+    jcp.LDA = jcp.tr_iw;
+    jcp.LDB = jcp.ngroups * jcp.oc_without_padding;
+    jcp.LDC = jcp.LDD = jcp.ngroups * jcp.oc_without_padding;
+
+    // The batch goes over the output rows of an oh block, pick the block so
+    // that the transposed source rows fit in half of L2.
+    const size_t L2 = platform::get_per_core_cache_size(2);
+    const size_t tr_row_size = (size_t)jcp.stride_w * jcp.ic_block * jcp.tr_iw
+            * jcp.src_dsz;
+    const int kh_ext = (jcp.kh - 1) * (jcp.dilate_h + 1);
+    auto get_tr_ih = [&](int oh_block) {
+        return (oh_block - 1) * jcp.stride_h + kh_ext + 1;
+    };
+    jcp.oh_block = jcp.oh;
+    while (jcp.oh_block > 1 && get_tr_ih(jcp.oh_block) * tr_row_size > L2 / 2)
+        jcp.oh_block = div_up(jcp.oh_block, 2);
+    jcp.max_batch = jcp.adjusted_batch_size = jcp.oh_block;
+    jcp.tr_src_buf_size = (size_t)get_tr_ih(jcp.oh_block) * jcp.stride_w
+            * jcp.ic_block * jcp.tr_iw;
+
+    jcp.nthr_mb_work = jcp.mb * jcp.od;
+    balance_bwd_w(jcp);
 
     return status::success;
 }
@@ -2433,63 +2569,18 @@ status_t init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
     const memory_desc_wrapper diff_weights_d(&diff_weights_md);
     const memory_desc_wrapper diff_dst_d(&diff_dst_md);
 
-    const size_t tr_src_size = jcp.tr_src_buf_count * jcp.tr_src_buf_size
-            + jcp.tr_src_num_guard_elems;
-    scratchpad.book(key_conv_tr_src, tr_src_size, jcp.src_dsz);
-
-    /* prepare synchronization contexts */
-    if (jcp.global_transpose && jcp.nthr_oc_b > 1) {
-        const int tr_src_bctx_size = jcp.nthr / jcp.nthr_oc_b;
-        scratchpad.book<simple_barrier::ctx_t>(
-                key_conv_tr_src_bctx, tr_src_bctx_size);
-    }
-
-    // The tr_ow <= tr_iw, so we need some guarding at the end of diff_dst
-    // TODO: update this guarding:
-    // (jcp.tr_diff_dst_buf_size + jcp.tr_iw * jcp.oc_block)
-    const auto tr_diff_dst_size
-            = jcp.tr_diff_dst_buf_count * jcp.tr_diff_dst_buf_size
-            + jcp.tr_iw * jcp.oc_block;
-
-    const size_t min_align = 64;
-    scratchpad.book(
-            key_conv_tr_diff_dst, tr_diff_dst_size, jcp.src_dsz, min_align);
-
-    /* prepare synchronization contexts */
-    if (jcp.global_transpose && jcp.nthr_ic_b > 1) {
-        const size_t tr_diff_dst_bctx_size = jcp.nthr / jcp.nthr_ic_b;
-        scratchpad.book<simple_barrier::ctx_t>(
-                key_conv_tr_diff_dst_bctx, tr_diff_dst_bctx_size);
-    }
-
-    if (IMPLICATION(jcp.nthr_mb == 1,
-                (jcp.with_bias && jcp.bia_dt != data_type::f32)
-                        || jcp.wei_dt != data_type::f32)) {
-        const size_t wei_size = jcp.ngroups * jcp.nb_oc * jcp.oc_block
-                * jcp.nb_ic * jcp.ic_block * jcp.kh * jcp.kw * jcp.kd;
-        const size_t bia_size
-                = jcp.with_bias * jcp.ngroups * jcp.nb_oc * jcp.oc_block;
-
-        const int num_wei_buffers
-                = jcp.wei_dt != data_type::f32 ? jcp.nthr_mb : jcp.nthr_mb - 1;
-        const int num_bia_buffers = jcp.with_bias
-                ? (jcp.bia_dt != data_type::f32 ? jcp.nthr_mb : jcp.nthr_mb - 1)
-                : 0;
-
-        const size_t wei_bia_reduction_size
-                = wei_size * num_wei_buffers + bia_size * num_bia_buffers;
+    scratchpad.book(key_conv_tr_src,
+            static_cast<size_t>(jcp.nthr) * jcp.tr_src_buf_size, jcp.src_dsz,
+            0, P4K);
 
+    // Threads working on the first part of the minibatch accumulate directly
+    // into diff_weights, the others use their own copy which is reduced at
+    // the end of the execution.
+    if (jcp.nthr_mb > 1) {
+        const size_t wei_size = static_cast<size_t>(jcp.ngroups) * jcp.oc
+                * jcp.ic * jcp.kd * jcp.kh * jcp.kw;
         scratchpad.book<float>(
-                key_conv_wei_bia_reduction, wei_bia_reduction_size);
-
-        scratchpad.book<simple_barrier::ctx_t>(
-                key_conv_wei_bia_reduction_bctx, 1);
-    }
-
-    if (jcp.with_bias
-            && ((jcp.oc % jcp.oc_block != 0) && jcp.bia_dt == data_type::f32)) {
-        scratchpad.book(key_conv_padded_bias,
-                jcp.ngroups * jcp.nb_oc * jcp.oc_block, jcp.bia_dsz);
+                key_conv_wei_bia_reduction, wei_size * (jcp.nthr_mb - 1));
     }
 
     constexpr size_t scratchpad_limit_by_absolute_value = (size_t)32
@@ -39,6 +39,10 @@ constexpr size_t P4K = 4096;
 bool uses_batch_elements(
         brgemm_batch_kind_t brg_type, conv_brgemm_exec_type_t exec_type);
 
+// Granularity of the reduce dimension in the weights layout. f16 weights are
+// not in vnni format as the f16 brgemm kernels convert them to f32.
+int get_wei_vnni_granularity(data_type_t wei_dt);
+
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -52,7 +56,7 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const jit_brgemm_conv_conf_t &jcp);
 
-status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
+status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
         memory_desc_t &diff_dst_md, primitive_attr_t &attr, int nthreads);
@@ -205,6 +205,9 @@ private:
             case sve_256:
                 simd_w_ = cpu_isa_traits<sve_256>::vlen / sizeof(float);
                 break;
+            case sve_128:
+                simd_w_ = cpu_isa_traits<sve_128>::vlen / sizeof(float);
+                break;
             default: {
                 assert(!"unsupported isa");
                 return;
@@ -862,6 +865,9 @@ private:
             case sve_256:
                 simd_w_ = cpu_isa_traits<sve_256>::vlen / sizeof(float);
                 break;
+            case sve_128:
+                simd_w_ = cpu_isa_traits<sve_128>::vlen / sizeof(float);
+                break;
             default: {
                 assert(!"unsupported isa");
                 return;
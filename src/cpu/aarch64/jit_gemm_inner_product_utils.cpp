@@ -0,0 +1,263 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_gemm_inner_product_utils.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace inner_product_utils {
+
+using namespace Xbyak_aarch64;
+using cpu::inner_product_utils::pp_kernel_t;
+
+namespace {
+
+bool post_ops_supported(cpu_isa_t isa, const post_ops_t &post_ops,
+        data_type_t dst_dt, bool skip_sum) {
+    using namespace data_type;
+    for (int i = 0; i < post_ops.len(); i++) {
+        const auto &e = post_ops.entry_[i];
+        if (e.is_eltwise()) {
+            if (!eltwise_injector::is_supported(isa, e.eltwise.alg))
+                return false;
+        } else if (e.is_sum(false, false)) {
+            if (skip_sum) continue;
+            const auto sum_dt = e.sum.dt == undef ? dst_dt : e.sum.dt;
+            // The previous destination value is accumulated before the
+            // eltwise chain, hence the sum has to come first.
+            if (i != 0 || e.sum.zero_point != 0 || sum_dt != f32)
+                return false;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+struct jit_pp_kernel_t : public pp_kernel_t, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(inner_product_utils::jit_pp_kernel_t);
+
+    jit_pp_kernel_t(size_t OC, size_t MB, dim_t dst_mb_stride,
+            const primitive_attr_t *attr, data_type_t bias_dt,
+            data_type_t acc_dt, const memory_desc_t *dst_md, bool skip_sum)
+        : pp_kernel_t(OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md,
+                skip_sum) {
+        // The sum post-op is applied separately, the rest of the chain is
+        // made of eltwise entries only (see post_ops_supported()).
+        for (int i = 0; i < post_ops_.len(); i++) {
+            const auto &e = post_ops_.entry_[i];
+            if (!e.is_eltwise()) continue;
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                            /* save_state = */ false, reg_table, p_elt_mask,
+                            p_elt_tmp));
+        }
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+    void operator()(void *dst, const void *acc, const char *bias,
+            const float *scales, float dst_scale, size_t start,
+            size_t dst_logical_off, size_t dim1_off, size_t end,
+            size_t runtime_oc, dim_t dst_mb_stride,
+            const float *dst_zero_points,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+            size_t first_mb_matrix_addr_off, const exec_ctx_t &ctx,
+            const memory_desc_t &dst_md) const override;
+
+private:
+    struct ker_args_t {
+        float *dst;
+        const float *acc;
+        const float *bias;
+        size_t len;
+    };
+
+    void generate() override;
+
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    const XReg reg_param = param1;
+    const XReg reg_dst = x1;
+    const XReg reg_acc = x2;
+    const XReg reg_bias = x3;
+    const XReg reg_len = x4;
+    const XReg reg_idx = x5;
+    const XReg reg_table = x6;
+
+    const PReg p_lanes = p2;
+    const PReg p_elt_mask = p1;
+    const PReg p_elt_tmp = p4;
+
+    // Eltwise injectors take auxiliary registers starting from z0, the
+    // kernel data lives at the top of the register file.
+    const TReg vreg_data = TReg(31);
+    const TReg vreg_tmp = TReg(30);
+    const TReg vreg_sum_scale = TReg(29);
+
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+};
+
+template <cpu_isa_t isa>
+void jit_pp_kernel_t<isa>::generate() {
+#define GET_OFF(field) offsetof(ker_args_t, field)
+    preamble();
+
+    if (simd_w_ != cpu_sveLen / sizeof(float))
+        set_preg(P_ALL_ONE.s, simd_w_, X_TMP_0, X_TMP_1);
+
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(dst), X_TMP_0);
+    ldr(reg_dst, ptr(X_DEFAULT_ADDR));
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(acc), X_TMP_0);
+    ldr(reg_acc, ptr(X_DEFAULT_ADDR));
+    if (do_bias()) {
+        add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(bias), X_TMP_0);
+        ldr(reg_bias, ptr(X_DEFAULT_ADDR));
+    }
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(len), X_TMP_0);
+    ldr(reg_len, ptr(X_DEFAULT_ADDR));
+#undef GET_OFF
+
+    if (do_sum_) init_vmm(vreg_sum_scale, X_TMP_0, sum_scale_);
+
+    Label vec_loop, vec_loop_end;
+
+    mov_imm(reg_idx, 0);
+    L(vec_loop);
+    {
+        cmp(reg_idx, reg_len);
+        b(GE, vec_loop_end);
+
+        // The last iteration processes the tail with a partial predicate
+        whilelt(p_lanes.s, reg_idx, reg_len);
+        and_(p_lanes.b, P_ALL_ONE / T_z, p_lanes.b, p_lanes.b);
+
+        ld1w(vreg_data.s, p_lanes / T_z, ptr(reg_acc, reg_idx, LSL, 2));
+        if (do_bias()) {
+            ld1w(vreg_tmp.s, p_lanes / T_z, ptr(reg_bias, reg_idx, LSL, 2));
+            fadd(vreg_data.s, vreg_data.s, vreg_tmp.s);
+        }
+        if (do_sum_) {
+            ld1w(vreg_tmp.s, p_lanes / T_z, ptr(reg_dst, reg_idx, LSL, 2));
+            fmla(vreg_data.s, P_ALL_ONE / T_m, vreg_tmp.s, vreg_sum_scale.s);
+        }
+        for (auto &injector : eltwise_injectors_) {
+            // Every injector owns its own table of constants.
+            injector->load_table_addr();
+            injector->compute_vector(vreg_data.getIdx());
+        }
+        st1w(vreg_data.s, p_lanes, ptr(reg_dst, reg_idx, LSL, 2));
+
+        add_imm(reg_idx, reg_idx, simd_w_, X_TMP_0);
+        b(vec_loop);
+    }
+    L(vec_loop_end);
+
+    postamble();
+
+    for (auto &injector : eltwise_injectors_)
+        injector->prepare_table();
+}
+
+template <cpu_isa_t isa>
+void jit_pp_kernel_t<isa>::operator()(void *dst, const void *acc,
+        const char *bias, const float * /* scales */, float /* dst_scale */,
+        size_t start, size_t /* dst_logical_off */, size_t /* dim1_off */,
+        size_t end, size_t runtime_oc, dim_t dst_mb_stride,
+        const float * /* dst_zero_points */,
+        const void * /* post_ops_binary_rhs_arg_vec */,
+        const void * /* dst_orig */, size_t /* first_mb_matrix_addr_off */,
+        const exec_ctx_t & /* ctx */,
+        const memory_desc_t & /* dst_md */) const {
+    if (end <= start) return;
+    const size_t OC = this->runtime_oc() ? runtime_oc : this->OC_;
+    const bool trivial_stride = (size_t)dst_mb_stride == OC;
+    // If dst and acc point to the same buffer (in-place), they share the
+    // strides, otherwise the accumulator is dense.
+    const bool acc_is_dst = dst == acc;
+
+    // Without bias the kernel does not depend on the channel, so dense rows
+    // are processed at once. Otherwise it works on a row at a time.
+    const bool single_piece = trivial_stride && !this->do_bias();
+
+    ker_args_t args;
+    size_t i = start;
+    while (i < end) {
+        const size_t oc = i % OC;
+        const size_t len = single_piece ? end - i
+                                        : nstl::min(end, i - oc + OC) - i;
+        const size_t dst_off
+                = trivial_stride ? i : (i / OC) * dst_mb_stride + oc;
+        args.dst = static_cast<float *>(dst) + dst_off;
+        args.acc = static_cast<const float *>(acc)
+                + (acc_is_dst ? dst_off : i);
+        args.bias = this->do_bias()
+                ? reinterpret_cast<const float *>(bias) + oc
+                : nullptr;
+        args.len = len;
+        jit_generator::operator()(&args);
+        i += len;
+    }
+}
+
+pp_kernel_t *jit_pp_kernel_create(size_t OC, size_t MB, dim_t dst_mb_stride,
+        const primitive_attr_t *attr, data_type_t bias_dt, data_type_t acc_dt,
+        const memory_desc_t *dst_md, bool skip_sum) {
+    using namespace data_type;
+    const bool ok = acc_dt == f32 && dst_md->data_type == f32
+            && utils::one_of(bias_dt, f32, undef)
+            && attr->scales_.has_default_values()
+            && attr->zero_points_.has_default_values();
+    if (!ok) return nullptr;
+
+#define CASE(isa) \
+    do { \
+        if (mayiuse(isa) \
+                && post_ops_supported( \
+                        isa, attr->post_ops_, dst_md->data_type, skip_sum)) \
+            return new jit_pp_kernel_t<isa>(OC, MB, dst_mb_stride, attr, \
+                    bias_dt, acc_dt, dst_md, skip_sum); \
+    } while (false)
+    CASE(sve_512);
+    CASE(sve_256);
+    CASE(sve_128);
+#undef CASE
+    return nullptr;
+}
+
+} // namespace inner_product_utils
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -722,6 +722,7 @@ struct jit_binary_conf_t {
     bool is_i8 = false;
     bool is_bf16 = false;
     bool is_src_different_layouts = false;
+    bool use_nt_stores = false;
     dim_t outer_dims = 1;
     int src1_stride = 1;
     int not_bcasted_sp_dims = 0;
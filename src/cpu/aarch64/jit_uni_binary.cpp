@@ -20,6 +20,7 @@
 
 #include "common/dnnl_thread.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/aarch64/jit_uni_binary.hpp"
@@ -166,6 +167,9 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
                             && conf_.bcast_type == bcast_t::per_w));
     conf_.use_stride_rhs_postops = conf_.postops_per_oc_broadcast_exists
             && conf_.op_type == op_t::n_spatial_c;
+    // Large outputs are streamed to memory to keep the data of the following
+    // primitive in cache.
+    conf_.use_nt_stores = platform::use_nt_stores(dst_md_.size());
 
     const auto ndims = src0_md_.ndims();
     if (conf_.is_src_different_layouts) {
@@ -87,7 +87,7 @@ jit_uni_binary_kernel_t<isa>::jit_uni_binary_kernel_t(
     , offt_src0_(vlen_)
     , offt_src1_(conf_.use_stride_src1 ? offt_src0_ : 0)
     , io_(this, isa, {conf_.src0_type, conf_.src1_type, conf_.dst_type},
-              {false},
+              {conf_.use_nt_stores},
               io::io_tail_conf_t {simd_w_, tail_size_, tail_opmask_,
                       static_cast<int>(vmm_tail_vmask_.getIdx()), reg_tmp_,
                       reg_tmp1_},
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/jit_uni_concat.hpp"
+
+#define GET_OFF(field) offsetof(jit_concat_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+jit_uni_concat_kernel_t<isa>::jit_uni_concat_kernel_t(bool use_nt_stores)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true)
+    , use_nt_stores_(use_nt_stores) {}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::store(
+        const TReg &v, const PReg &p, const XReg &offt) {
+    if (use_nt_stores_)
+        stnt1b(v.b, p, ptr(reg_dst, offt));
+    else
+        st1b(v.b, p, ptr(reg_dst, offt));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::generate() {
+    preamble();
+
+    if (vlen_ != cpu_sveLen) set_preg(P_ALL_ONE.b, vlen_, X_TMP_0, X_TMP_1);
+
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(src), X_TMP_0);
+    ldr(reg_src, ptr(X_DEFAULT_ADDR));
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(dst), X_TMP_0);
+    ldr(reg_dst, ptr(X_DEFAULT_ADDR));
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(size), X_TMP_0);
+    ldr(reg_size, ptr(X_DEFAULT_ADDR));
+
+    Label unroll_loop, tail_loop, tail_loop_end;
+
+    mov_imm(reg_idx, 0);
+    L(unroll_loop);
+    {
+        add_imm(X_TMP_0, reg_idx, unroll_ * vlen_, X_TMP_1);
+        cmp(X_TMP_0, reg_size);
+        b(GT, tail_loop);
+
+        for (int u = 1; u < unroll_; u++)
+            add_imm(reg_offt[u], reg_idx, u * vlen_, X_TMP_0);
+        for (int u = 0; u < unroll_; u++)
+            ld1b(TReg(u).b, P_ALL_ONE / T_z, ptr(reg_src, reg_offt[u]));
+        for (int u = 0; u < unroll_; u++)
+            store(TReg(u), P_ALL_ONE, reg_offt[u]);
+
+        add_imm(reg_idx, reg_idx, unroll_ * vlen_, X_TMP_0);
+        b(unroll_loop);
+    }
+
+    L(tail_loop);
+    {
+        cmp(reg_idx, reg_size);
+        b(GE, tail_loop_end);
+
+        // The last iteration copies the tail with a partial predicate
+        whilelt(p_tail.b, reg_idx, reg_size);
+        and_(p_tail.b, P_ALL_ONE / T_z, p_tail.b, p_tail.b);
+
+        ld1b(TReg(0).b, p_tail / T_z, ptr(reg_src, reg_idx));
+        store(TReg(0), p_tail, reg_idx);
+
+        add_imm(reg_idx, reg_idx, vlen_, X_TMP_0);
+        b(tail_loop);
+    }
+    L(tail_loop_end);
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::pd_t::init(engine_t *engine) {
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_CONCAT(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    // The copy is done in bytes, any data type goes.
+    CHECK(init_simple(engine, dst_md()->data_type));
+
+    const memory_desc_wrapper dst_d(dst_md());
+    use_nt_stores_ = platform::use_nt_stores(dst_d.size());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_concat_kernel_t<isa>(pd()->use_nt_stores_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::execute(const exec_ctx_t &ctx) const {
+    return execute_simple_concat(
+            ctx, pd(), [&](char *dst, const char *src, size_t size) {
+                jit_concat_call_s args;
+                args.src = src;
+                args.dst = dst;
+                args.size = size;
+                (*kernel_)(&args);
+            });
+}
+
+template struct jit_uni_concat_kernel_t<sve_512>;
+template struct jit_uni_concat_kernel_t<sve_256>;
+template struct jit_uni_concat_kernel_t<sve_128>;
+template struct jit_uni_concat_t<sve_512>;
+template struct jit_uni_concat_t<sve_256>;
+template struct jit_uni_concat_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_CONCAT_HPP
+#define CPU_AARCH64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/simple_concat.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_concat_call_s {
+    const void *src;
+    void *dst;
+    size_t size; // in bytes
+};
+
+// Copies `size` bytes from `src` to `dst`. Non-temporal stores keep a large
+// destination from evicting the inputs and the data of the next layers from
+// the caches.
+template <cpu_isa_t isa>
+struct jit_uni_concat_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_kernel_t)
+
+    jit_uni_concat_kernel_t(bool use_nt_stores);
+
+private:
+    using XReg = Xbyak_aarch64::XReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr int unroll_ = 4;
+
+    void generate() override;
+    void store(const TReg &v, const PReg &p, const XReg &offt);
+
+    const bool use_nt_stores_;
+
+    const XReg reg_param = abi_param1;
+    const XReg reg_src = x1;
+    const XReg reg_dst = x2;
+    const XReg reg_size = x3;
+    // byte offsets of the unrolled vectors, the first one is the loop index
+    const XReg reg_offt[unroll_] = {x4, x5, x6, x7};
+    const XReg &reg_idx = reg_offt[0];
+
+    const PReg p_tail = p1;
+};
+
+// Simple concat with the chunks copied by a jit kernel.
+template <cpu_isa_t isa>
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public simple_concat_base_pd_t {
+        using simple_concat_base_pd_t::simple_concat_base_pd_t;
+
+        DECLARE_CONCAT_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        bool use_nt_stores_ = false;
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_concat_kernel_t<isa>> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,8 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/aarch64/jit_generator.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
@@ -44,12 +46,20 @@ struct jit_args_t {
 };
 
 struct jit_uni_eltwise_kernel_t : public jit_generator {
-    jit_uni_eltwise_kernel_t(const eltwise_pd_t *pd) : pd_(pd) {}
+    jit_uni_eltwise_kernel_t(const eltwise_pd_t *pd)
+        : pd_(pd)
+        , use_nt_stores_(platform::use_nt_stores(
+                  memory_desc_wrapper(pd->is_fwd() ? pd->dst_md()
+                                                   : pd->diff_src_md())
+                          .size())) {}
 
     void operator()(jit_args_t *p) { jit_generator::operator()(p); }
 
 protected:
     const eltwise_pd_t *pd_;
+    // Large outputs are streamed to memory to keep the data of the following
+    // primitive in cache.
+    const bool use_nt_stores_;
 
     data_type_t data_type() const {
         return pd_->use_dst() ? pd_->dst_md()->data_type
@@ -133,7 +143,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
                     {vmm_src.getIdx(), tmp0.getIdx()});
             bfcvt(vmm_src.h, pg_h, vmm_src.s);
             bfcvtnt(vmm_src.h, pg_h, tmp0.s);
-            st1h(vmm_src.h, pg_h / T_z, ptr(reg_dst));
+            store_h(vmm_src.h);
         } else if (is_f16()) {
             ld1h(vmm_src.h, pg_h / T_z, ptr(reg_src));
             // Convert FP16 to FP32, apply eltwise op, then convert back to FP16:
@@ -154,7 +164,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
             fcvt(tmp0.h, pg_s, tmp0.s);
             lsl(tmp0.s, tmp0.s, 16);
             orr(vmm_src.h, pg_h, tmp0.h);
-            st1h(vmm_src.h, pg_h / T_z, ptr(reg_dst));
+            store_h(vmm_src.h);
         } else {
             ld1w(vmm_src.s, pg_s / T_z, ptr(reg_src));
             eltwise_injector_->compute_vector(vmm_src.getIdx());
@@ -163,7 +173,10 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
                         ptr(reg_diff_dst));
                 fmul(vmm_src.s, vmm_src.s, vmm_diff_dst);
             }
-            st1w(vmm_src.s, pg_s / T_z, ptr(reg_dst));
+            if (use_nt_stores_)
+                stnt1w(vmm_src.s, pg_s, ptr(reg_dst));
+            else
+                st1w(vmm_src.s, pg_s / T_z, ptr(reg_dst));
         }
 
         const auto shift = cpu_isa_traits<isa>::vlen;
@@ -206,6 +219,13 @@ private:
     int vlen() { return cpu_isa_traits<isa>::vlen; }
     int simd_w() { return vlen() / dtype_size(); }
 
+    void store_h(const ZRegH &vmm) {
+        if (use_nt_stores_)
+            stnt1h(vmm, pg_h, ptr(reg_dst));
+        else
+            st1h(vmm, pg_h / T_z, ptr(reg_dst));
+    }
+
     XReg reg_src = x11;
     XReg reg_dst = x8;
     XReg reg_injector_table = x9;
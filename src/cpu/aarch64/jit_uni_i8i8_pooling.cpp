@@ -94,7 +94,6 @@ struct jit_uni_i8i8_pooling_fwd_ker_t : public jit_generator {
     PReg mask(int idx) { return PReg(6 - idx); } /* 6, 5, 4, 3 */
 
     PReg p_all_zero = p2;
-    PReg p_tmp0 = p1;
 
     VReg xmm_tmp = xreg(0); // temp to init vreg_tmp
     TReg vreg_tmp = vreg(0); // max pooling : holds minimum values for data_type
@@ -181,31 +180,30 @@ struct jit_uni_i8i8_pooling_fwd_ker_t : public jit_generator {
         : jit_generator(nullptr, MAX_CODE_SIZE, true), jpp(jpp_) {}
 };
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_max_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src_max_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
+    add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
     if (masked) {
         if (jpp.src_dt == s32) {
-            add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
-            zip1(p_tmp0.b, mask(0).b, p_all_zero.b);
-            zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-            ld1w(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
-            mov(vreg_src(jj).s, p_tmp0 / T_m, z_tmp0.s);
+            ld1w(z_tmp0.s, mask(0) / T_z, ptr(X_DEFAULT_ADDR));
+            mov(vreg_src(jj).s, mask(0) / T_m, z_tmp0.s);
         } else {
-            add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
             ld1b(z_tmp0.b, mask(0) / T_z, ptr(X_DEFAULT_ADDR));
             mov(vreg_src(jj).b, mask(0) / T_m, z_tmp0.b);
         }
     } else {
-        add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
-        ldr(vreg_src(jj), ptr(X_DEFAULT_ADDR));
+        if (jpp.src_dt == s32)
+            ld1w(vreg_src(jj).s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+        else
+            ld1b(vreg_src(jj).b, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
     }
 };
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src_avg_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -216,22 +214,17 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
             add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset * data_type_size(s32),
                     X_TMP_0);
             if (masked) {
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                ld1w(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
-                mov(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
+                ld1w(z_tmp0.s, mask(ll) / T_z, ptr(X_DEFAULT_ADDR));
+                mov(vr_src.s, mask(ll) / T_m, z_tmp0.s);
             } else {
-                ldr(vr_src, ptr(X_DEFAULT_ADDR));
+                ld1w(vr_src.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
             }
             break;
         case data_type::s8:
             add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
             if (masked) {
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                // use p_tmp, uzp1 can be eliminate.
-                ld1b(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
-                sxtb(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
+                ld1b(z_tmp0.s, mask(ll) / T_z, ptr(X_DEFAULT_ADDR));
+                sxtb(vr_src.s, mask(ll) / T_m, z_tmp0.s);
             } else {
                 ld1b(z_tmp0.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
                 sxtb(vr_src.s, P_ALL_ONE / T_m, z_tmp0.s);
@@ -240,15 +233,10 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
         case u8:
             add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
             if (masked) {
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                // use p_tmp, uzp1 can be eliminate.
-                ld1b(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
-                uxtb(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
+                ld1b(z_tmp0.s, mask(ll) / T_z, ptr(X_DEFAULT_ADDR));
+                uxtb(vr_src.s, mask(ll) / T_m, z_tmp0.s);
             } else {
-                ldr(QReg(z_tmp0.getIdx()), ptr(X_DEFAULT_ADDR));
-                zip1(z_tmp0.b, z_tmp0.b, z_tmp0.b);
-                zip1(z_tmp0.h, z_tmp0.h, z_tmp0.h);
+                ld1b(z_tmp0.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
                 uxtb(vr_src.s, P_ALL_ONE / T_m, z_tmp0.s);
             }
             break;
@@ -282,34 +270,23 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src(int jj, int ll, int c_tail) {
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_max_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst_max_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
-    if (masked) {
-        switch (jpp.src_dt) {
-            case s32:
-                add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
-                zip1(p_tmp0.b, mask(0).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                st1w(vreg_dst(jj).s, p_tmp0, ptr(X_DEFAULT_ADDR));
-                break;
-            case data_type::s8:
-            case u8:
-                add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
-                st1b(vreg_dst(jj).b, mask(0), ptr(X_DEFAULT_ADDR));
-                break;
-            default: assert(!"unsupported src data type");
-        }
-    } else {
-        add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
-        str(vreg_dst(jj), ptr(X_DEFAULT_ADDR));
+    const PReg p_st = masked ? mask(0) : P_ALL_ONE;
+    add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
+    switch (jpp.src_dt) {
+        case s32: st1w(vreg_dst(jj).s, p_st, ptr(X_DEFAULT_ADDR)); break;
+        case data_type::s8:
+        case u8: st1b(vreg_dst(jj).b, p_st, ptr(X_DEFAULT_ADDR)); break;
+        default: assert(!"unsupported src data type");
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst_avg_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -321,11 +298,9 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
         case s32:
             add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
             if (masked) {
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                st1w(vr_dst.s, p_tmp0, ptr(X_DEFAULT_ADDR));
+                st1w(vr_dst.s, mask(ll), ptr(X_DEFAULT_ADDR));
             } else {
-                str(vr_dst, ptr(X_DEFAULT_ADDR));
+                st1w(vr_dst.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
             }
             break;
         case data_type::s8:
@@ -334,9 +309,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
                 mov(z_tmp0.d, vr_dst.d);
                 smin(z_tmp0.s, 127);
                 smax(z_tmp0.s, -128);
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                st1b(z_tmp0.s, p_tmp0, ptr(X_DEFAULT_ADDR));
+                st1b(z_tmp0.s, mask(ll), ptr(X_DEFAULT_ADDR));
             } else {
                 mov(z_tmp0.d, vr_dst.d);
                 smin(z_tmp0.s, 127);
@@ -349,9 +322,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
             if (masked) {
                 mov(z_tmp0.d, vr_dst.d);
                 umin(z_tmp0.s, 255);
-                zip1(p_tmp0.b, mask(ll).b, p_all_zero.b);
-                zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
-                st1b(z_tmp0.s, p_tmp0, ptr(X_DEFAULT_ADDR));
+                st1b(z_tmp0.s, mask(ll), ptr(X_DEFAULT_ADDR));
             } else {
                 mov(z_tmp0.d, vr_dst.d);
                 umin(z_tmp0.s, 255);
@@ -389,8 +360,8 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst(
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::compute_max_op(const int jj) {
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_max_op(const int jj) {
     using namespace data_type;
 
     // Compare
@@ -605,19 +576,26 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_c_block() {
     if (ur_c_tail != 0) { compute_step(ur_c_tail, c_tail); }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::init_mask() {
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_mask() {
     using namespace data_type;
 
-    sub(X_TRANSLATOR_STACK, X_TRANSLATOR_STACK, 8 * max_num_ll);
-
-    for (int ll = 0; ll < max_num_ll; ll++) {
-        mov_imm(reg_mask, jpp.tail[ll]);
-        str(reg_mask, ptr(X_TRANSLATOR_STACK, 8 * ll));
+    // Max pooling uses a single mask in src_dt elements, avg pooling uses
+    // one mask per s32 chunk of the channel block.
+    if (jpp.alg == pooling_max) {
+        if (jpp.src_dt == s32)
+            set_preg(mask(0).s, jpp.c_tail, X_TMP_0, X_TMP_1);
+        else
+            set_preg(mask(0).b, jpp.c_tail, X_TMP_0, X_TMP_1);
+        return;
     }
+
+    const int msk_gran
+            = cpu_isa_traits<isa>::vlen / data_type_size(avg_proc_dt);
     for (int ll = 0; ll < max_num_ll; ll++) {
-        ldr(PReg(mask(ll)), ptr(X_TRANSLATOR_STACK));
-        add(X_TRANSLATOR_STACK, X_TRANSLATOR_STACK, 8);
+        const int n = nstl::min(
+                nstl::max(jpp.c_tail - ll * msk_gran, 0), msk_gran);
+        set_preg(mask(ll).s, n, X_TMP_0, X_TMP_1);
     }
 }
 
@@ -652,13 +630,10 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_tmp_reg() {
 
             bic(xmm_tmp.b16, xmm_tmp.b16, xmm_tmp.b16);
             mov(xmm_tmp.d[0], reg_tmp);
-            if (jpp.src_dt == s32) {
+            if (jpp.src_dt == s32)
                 dup(vreg_tmp.s, ZRegS(xmm_tmp.getIdx())[0]);
-            } else if (mayiuse(sve_512)) {
+            else
                 dup(ZRegB(vreg_tmp.getIdx()), ZRegB(xmm_tmp.getIdx())[0]);
-            } else {
-                assert(!"unreachable");
-            }
             break;
         default: assert(!"unsupported pooling algorithm");
     }
@@ -669,6 +644,8 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::generate() {
     preamble();
 
     pfalse(p_all_zero.b);
+    if (cpu_isa_traits<isa>::vlen != cpu_sveLen)
+        set_preg(P_ALL_ONE.b, cpu_isa_traits<isa>::vlen, X_TMP_0, X_TMP_1);
 
     add_imm(X_DEFAULT_ADDR, reg_param, offsetof(call_params_t, src_i8),
             X_TMP_0);
@@ -757,16 +734,16 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
 
     // data_type items per one vreg on the <isa>
     //     isa == sve_512 : 64 bytes -> 64 for s8/u8, 16 for s32
+    //     isa == sve_256 : 32 bytes -> 32 for s8/u8, 8 for s32
+    //     isa == sve_128 : 16 bytes -> 16 for s8/u8, 4 for s32
     int simd_w = cpu_isa_traits<isa>::vlen / data_type_size(jpp.src_dt);
 
     /* Verify that vlen-sized memory access happens within the tensor's
      * size, otherwise load/store will always spill outside the memory
      * boundary.*/
-    bool safe_load_n_store = IMPLICATION(utils::one_of(isa, sve_512),
-            jpp.mb * jpp.c * nstl::min(jpp.id, jpp.od)
-                            * nstl::min(jpp.ih, jpp.oh)
-                            * nstl::min(jpp.iw, jpp.ow)
-                    >= simd_w);
+    bool safe_load_n_store = jpp.mb * jpp.c * nstl::min(jpp.id, jpp.od)
+                    * nstl::min(jpp.ih, jpp.oh) * nstl::min(jpp.iw, jpp.ow)
+            >= simd_w;
     if (!safe_load_n_store) return status::unimplemented;
 
     jpp.c_block = simd_w;
@@ -792,7 +769,7 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
         case pooling_avg_include_padding:
         case pooling_avg_exclude_padding: {
             // avg_proc_dt (s32) defines granularity (because u8/s8 processed as s32)
-            // sve_512 : 16
+            // sve_512 : 16, sve_256 : 8, sve_128 : 4
             const size_t msk_gran
                     = cpu_isa_traits<isa>::vlen / data_type_size(avg_proc_dt);
             const size_t msk_msk = (1ULL << msk_gran) - 1;
@@ -907,6 +884,10 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
 //
 template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_512>;
 template struct jit_uni_i8i8_pooling_fwd_t<sve_512>;
+template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_256>;
+template struct jit_uni_i8i8_pooling_fwd_t<sve_256>;
+template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_128>;
+template struct jit_uni_i8i8_pooling_fwd_t<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
@@ -71,6 +71,14 @@ jit_uni_pool_kernel<isa>::jit_uni_pool_kernel(
     }
 }
 
+// There is no ASIMD post-ops injector, post_ops_ok() rejects post-ops.
+template <>
+jit_uni_pool_kernel<asimd>::jit_uni_pool_kernel(
+        const jit_pool_conf_t &ajpp, const memory_desc_t *dst_md)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true), jpp(ajpp) {
+    MAYBE_UNUSED(dst_md);
+}
+
 static status_t set_binary_postops_formats(
         post_ops_t &post_ops, const memory_desc_t *dst_md) {
     for (int idx = 0; idx < post_ops.len(); ++idx) {
@@ -124,6 +132,8 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     jpp.c_without_padding = src_d.dims()[1];
     switch (isa) {
         case sve_512: jpp.c_block = 16; break;
+        case sve_128:
+        case asimd: jpp.c_block = 4; break;
         default: jpp.c_block = 8; break;
     }
 
@@ -131,9 +141,10 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     jpp.tmp_md = memory_desc_t();
 
     using namespace format_tag;
-    const auto blocked_fmt_tag = utils::one_of(isa, sve_512)
+    const auto blocked_fmt_tag = isa == sve_512
             ? utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c)
-            : utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c);
+            : isa == sve_256 ? utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c)
+                             : utils::pick(ndims - 3, nCw4c, nChw4c, nCdhw4c);
 
     // src_d.data_type() is equal to dst_d.data_type(). This is checked in init
     auto ncsp_fmt_tag = format_tag::undef;
@@ -161,7 +172,8 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
 
     ncsp_fmt_tag
             = ((forward_ncsp_allowed || backward_ncsp_allowed)
-                      && utils::one_of(isa, sve_512, sve_256) && ndims <= 5)
+                      && utils::one_of(isa, sve_512, sve_256, sve_128)
+                      && ndims <= 5)
             ? utils::pick(ndims - 3, ncw, nchw, ncdhw)
             : format_tag::undef;
 
@@ -181,6 +193,7 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
         // plain output
         jpp.is_bf16 = false;
         jpp.is_f16 = false;
+        jpp.src_dt = data_type::f32;
         jpp.dt_size = types::data_type_size(data_type::f32);
         jpp.tag_kind = jit_memory_tag_kind_t::ncsp;
 
@@ -194,6 +207,7 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
                 && dst_d.data_type() == data_type::bf16);
         jpp.is_f16 = (src_d.data_type() == data_type::f16
                 && dst_d.data_type() == data_type::f16);
+        jpp.src_dt = src_d.data_type();
         jpp.dt_size = types::data_type_size(src_d.data_type());
         jpp.tag_kind = (fmt_tag == nspc_fmt_tag)
                 ? jit_memory_tag_kind_t::nspc
@@ -208,8 +222,11 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
 
     jpp.isa = isa;
 
+    // bf16 data is loaded with a shift, storing it requires BFCVT (BFCVTN
+    // for asimd) while f16 is converted with the base instructions.
     const bool args_ok = true && mayiuse(isa) && (fmt_tag != format_tag::undef)
-            && jpp.is_bf16 == false && jpp.is_f16 == false
+            && IMPLICATION(src_d.data_type() == data_type::bf16,
+                    mayiuse_bf16())
             && utils::one_of(pd.alg_kind, pooling_max,
                     pooling_avg_include_padding, pooling_avg_exclude_padding);
     if (!args_ok) return status::unimplemented;
@@ -224,6 +241,9 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     jpp.is_c_padded = jpp.tag_kind == jit_memory_tag_kind_t::blocked
             && src_d.padded_dims()[1] != jpp.c_without_padding;
 
+    // ASIMD has no predicates to mask the channel tail
+    if (isa == asimd && jpp.c_tail != 0) return status::unimplemented;
+
     jpp.stride_d = (ndims == 5) ? pd.strides[0] : 1;
     jpp.stride_h = (ndims == 3) ? 1 : pd.strides[ndims - 4];
     jpp.stride_w = pd.strides[ndims - 3];
@@ -247,6 +267,18 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
             || right_pad >= jpp.kw)
         return status::unimplemented;
 
+    // Overlapping windows make backward max pooling accumulate into
+    // diff_src, which would be done in 16 bits for bf16 and f16 data. Unlike
+    // x64 there is no f32 accumulation buffer, so only relaxed accumulation
+    // allows it.
+    const bool is_relaxed_acc = utils::one_of(
+            attr.acc_mode_, accumulation_mode::relaxed, accumulation_mode::any);
+    const bool has_overlap = jpp.stride_d < jpp.kd || jpp.stride_h < jpp.kh
+            || jpp.stride_w < jpp.kw;
+    if ((jpp.is_bf16 || jpp.is_f16) && jpp.alg == pooling_max
+            && jpp.is_backward && has_overlap && !is_relaxed_acc)
+        return status::unimplemented;
+
     jpp.ind_dt = ppd->workspace_md() ? ppd->workspace_md()->data_type
                                      : data_type::undef;
 
@@ -342,32 +374,111 @@ inline void jit_uni_pool_kernel<isa>::prepare_tail_mask() {
 }
 
 template <cpu_isa_t isa>
-inline void jit_uni_pool_kernel<isa>::load(const int idx, const xreg_t &reg_ptr,
-        const int offset, const bool is_c_tail_proccessing) {
-    if (is_c_tail_proccessing && !jpp.is_c_padded) {
-        add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
-        ld1w(ZRegS(idx), k_c_tail_mask_s / T_z, ptr(X_DEFAULT_ADDR));
-    } else {
-        add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
-        ld1w(ZRegS(idx), P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+inline void jit_uni_pool_kernel<isa>::load(const data_type_t dt, const int idx,
+        const xreg_t &reg_ptr, const int offset,
+        const bool is_c_tail_proccessing) {
+    const PReg mask = is_c_tail_proccessing && !jpp.is_c_padded
+            ? k_c_tail_mask_s
+            : P_ALL_ONE;
+    add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
+
+    // 16-bit values are widened to f32 in the 32-bit lanes
+    switch (dt) {
+        case data_type::bf16:
+            ld1h(ZRegS(idx), mask / T_z, ptr(X_DEFAULT_ADDR));
+            lsl(ZRegS(idx), ZRegS(idx), 16);
+            break;
+        case data_type::f16:
+            ld1h(ZRegS(idx), mask / T_z, ptr(X_DEFAULT_ADDR));
+            fcvt(ZRegS(idx), P_ALL_ONE / T_m, ZRegH(idx));
+            break;
+        case data_type::u8:
+            ld1b(ZRegS(idx), mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        default: ld1w(ZRegS(idx), mask / T_z, ptr(X_DEFAULT_ADDR)); break;
+    }
+}
+
+template <>
+inline void jit_uni_pool_kernel<asimd>::load(const data_type_t dt,
+        const int idx, const xreg_t &reg_ptr, const int offset,
+        const bool is_c_tail_proccessing) {
+    assert(!is_c_tail_proccessing);
+    add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
+
+    switch (dt) {
+        case data_type::bf16:
+            ldr(DReg(idx), ptr(X_DEFAULT_ADDR));
+            shll(VReg4S(idx), VReg4H(idx), 16);
+            break;
+        case data_type::f16:
+            ldr(DReg(idx), ptr(X_DEFAULT_ADDR));
+            fcvtl(VReg4S(idx), VReg4H(idx));
+            break;
+        case data_type::u8:
+            ldr(SReg(idx), ptr(X_DEFAULT_ADDR));
+            uxtl(VReg8H(idx), VReg8B(idx));
+            uxtl(VReg4S(idx), VReg4H(idx));
+            break;
+        default: ldr(QReg(idx), ptr(X_DEFAULT_ADDR)); break;
     }
 }
 
 template <cpu_isa_t isa>
-inline void jit_uni_pool_kernel<isa>::store(const int idx,
+inline void jit_uni_pool_kernel<isa>::store(const data_type_t dt, const int idx,
         const xreg_t &reg_ptr, const int offset,
         const bool is_c_tail_proccessing) {
     add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
 
+    PReg mask = P_ALL_ONE;
     if (is_c_tail_proccessing) {
-        if (!jpp.is_c_padded) {
-            st1w(ZRegS(idx), k_c_tail_mask_s, ptr(X_DEFAULT_ADDR));
-        } else {
-            if (jpp.with_postops) mov(ZRegS(idx), k_c_tail_mask_s_not / T_m, 0);
-            st1w(ZRegS(idx), P_ALL_ONE, ptr(X_DEFAULT_ADDR));
-        }
-    } else {
-        st1w(ZRegS(idx), P_ALL_ONE, ptr(X_DEFAULT_ADDR));
+        if (!jpp.is_c_padded)
+            mask = k_c_tail_mask_s;
+        else if (jpp.with_postops || dt == data_type::u8)
+            mov(ZRegS(idx), k_c_tail_mask_s_not / T_m, 0);
+    }
+
+    // 16-bit values are narrowed in place to the low half of the lanes
+    switch (dt) {
+        case data_type::bf16:
+            bfcvt(ZRegH(idx), P_ALL_ONE / T_m, ZRegS(idx));
+            st1h(ZRegS(idx), mask, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::f16:
+            fcvt(ZRegH(idx), P_ALL_ONE / T_m, ZRegS(idx));
+            st1h(ZRegS(idx), mask, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::u8:
+            umin(ZRegS(idx), 255);
+            st1b(ZRegS(idx), mask, ptr(X_DEFAULT_ADDR));
+            break;
+        default: st1w(ZRegS(idx), mask, ptr(X_DEFAULT_ADDR)); break;
+    }
+}
+
+template <>
+inline void jit_uni_pool_kernel<asimd>::store(const data_type_t dt,
+        const int idx, const xreg_t &reg_ptr, const int offset,
+        const bool is_c_tail_proccessing) {
+    assert(!is_c_tail_proccessing);
+    add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
+
+    switch (dt) {
+        case data_type::bf16:
+            bfcvtn(VReg4H(idx), VReg4S(idx));
+            str(DReg(idx), ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::f16:
+            fcvtn(VReg4H(idx), VReg4S(idx));
+            str(DReg(idx), ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::u8:
+            // saturating narrowing is the umin(255) of the SVE path
+            uqxtn(VReg4H(idx), VReg4S(idx));
+            uqxtn(VReg8B(idx), VReg8H(idx));
+            str(SReg(idx), ptr(X_DEFAULT_ADDR));
+            break;
+        default: str(QReg(idx), ptr(X_DEFAULT_ADDR)); break;
     }
 }
 
@@ -380,6 +491,8 @@ bool jit_uni_pool_kernel<isa>::post_ops_ok(jit_pool_conf_t &jpp,
     jpp.with_eltwise = false;
     jpp.with_binary = false;
 
+    if (isa == asimd && post_ops.len() > 0) return false;
+
     if (!jpp.is_backward) {
         for (const auto &entry : entries) {
             if (entry.is_eltwise()) {
@@ -445,6 +558,21 @@ void jit_uni_pool_kernel<isa>::apply_postops(int ur_bc, int ur_w, int c_block,
     postops_injector_->compute_vector_range(start_idx, end_idx, rhs_arg_params);
 }
 
+template <>
+void jit_uni_pool_kernel<asimd>::apply_postops(int ur_bc, int ur_w,
+        int c_block, const std::function<bool(int)> &is_tail_predicate) {
+    assert(!"unreachable");
+}
+
+template <cpu_isa_t isa>
+void jit_uni_pool_kernel<isa>::prepare_postops_table() {
+    if (jpp.with_eltwise && postops_injector_)
+        postops_injector_->prepare_table();
+}
+
+template <>
+void jit_uni_pool_kernel<asimd>::prepare_postops_table() {}
+
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel<isa>::maybe_recalculate_divisor(
         int jj, int ur_w, int pad_l, int pad_r, bool with_c_tail_proccessing) {
@@ -492,11 +620,11 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
             auto accvr = vreg(accr_i);
             if (jpp.is_backward) {
                 auto output_offset = dt_size * (jj * c_off + bci * c_block);
-                load(accvr.getIdx(), reg_output, output_offset,
+                load(jpp.src_dt, accvr.getIdx(), reg_output, output_offset,
                         is_tail_processing(bci));
-                fdiv(accvr.s, P_ALL_ONE, vmm_tmp.s);
+                uni_fdiv(accvr.s, accvr.s, vmm_tmp.s, vmm_tmp_1, P_ALL_ONE);
             } else {
-                eor(accvr.d, accvr.d, accvr.d);
+                uni_clear(accvr);
             }
         }
     }
@@ -532,21 +660,20 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = dt_size * aux_input_offset;
                 if (jpp.is_backward) {
-                    load(reg_idx(inpr_i), aux_reg_input, input_offset,
-                            is_tail_processing(bci));
+                    load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input,
+                            input_offset, is_tail_processing(bci));
 
                     fadd(inpvr.s, inpvr.s, accvr);
-                    store(reg_idx(inpr_i), aux_reg_input, input_offset,
-                            is_tail_processing(bci));
+                    store(jpp.src_dt, reg_idx(inpr_i), aux_reg_input,
+                            input_offset, is_tail_processing(bci));
                 } else {
                     if (is_tail_processing(bci)) {
-                        load(vmm_tmp_1.getIdx(), aux_reg_input, input_offset,
-                                is_tail_processing(bci));
+                        load(jpp.src_dt, vmm_tmp_1.getIdx(), aux_reg_input,
+                                input_offset, is_tail_processing(bci));
                         fadd(accvr, accvr, vmm_tmp_1);
                     } else {
-                        add_imm(X_DEFAULT_ADDR, aux_reg_input, input_offset,
-                                X_TMP_0);
-                        ld1w(z_tmp0.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+                        load(jpp.src_dt, z_tmp0.getIdx(), aux_reg_input,
+                                input_offset, false);
                         fadd(accvr, accvr, z_tmp0.s);
                     }
                 }
@@ -576,7 +703,7 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
             for (int bci = 0; bci < ur_bc; bci++) {
                 const auto accr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
                 const auto accvr = vreg(accr_i);
-                fdiv(accvr.s, P_ALL_ONE, vmm_tmp.s);
+                uni_fdiv(accvr.s, accvr.s, vmm_tmp.s, vmm_tmp_1, P_ALL_ONE);
             }
         }
 
@@ -588,13 +715,47 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                 const auto accr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
                 const auto output_offset
                         = dt_size * (jj * c_off + bci * c_block);
-                store(reg_idx(accr_i), reg_output, output_offset,
+                store(jpp.src_dt, reg_idx(accr_i), reg_output, output_offset,
                         is_tail_processing(bci));
             }
         }
     }
 }
 
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel<isa>::update_max(
+        const int acc_idx, const int inp_idx, const int ind_idx) {
+    fcmlt(k_store_mask.s, P_ALL_ONE / T_z, ZRegS(acc_idx), ZRegS(inp_idx));
+    sel(ZRegS(acc_idx), k_store_mask / T_m, ZRegS(inp_idx), ZRegS(acc_idx));
+    if (jpp.is_training)
+        sel(ZRegS(ind_idx), k_store_mask / T_m, vmm_k_offset, ZRegS(ind_idx));
+}
+
+template <>
+inline void jit_uni_pool_kernel<asimd>::update_max(
+        const int acc_idx, const int inp_idx, const int ind_idx) {
+    fcmgt(vmm_mask.s, VReg4S(inp_idx), VReg4S(acc_idx));
+    bit(VReg16B(acc_idx), VReg16B(inp_idx), vmm_mask.b16);
+    if (jpp.is_training)
+        bit(VReg16B(ind_idx), VReg16B(vmm_k_offset.getIdx()), vmm_mask.b16);
+}
+
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel<isa>::accumulate_diff(
+        const int inp_idx, const int out_idx, const int ind_idx) {
+    cmpeq(k_store_mask.s, P_ALL_ONE / T_z, ZRegS(ind_idx), vmm_k_offset);
+    fadd(ZRegS(inp_idx), k_store_mask / T_m, ZRegS(out_idx));
+}
+
+template <>
+inline void jit_uni_pool_kernel<asimd>::accumulate_diff(
+        const int inp_idx, const int out_idx, const int ind_idx) {
+    // lanes not selected by the index add zero
+    cmeq(vmm_mask.s, VReg4S(ind_idx), vmm_k_offset);
+    and_(vmm_mask.b16, vmm_mask.b16, VReg16B(out_idx));
+    fadd(VReg4S(inp_idx), VReg4S(inp_idx), vmm_mask.s);
+}
+
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
         int pad_l, int pad_r, bool with_c_tail_proccessing) {
@@ -615,14 +776,10 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
 
     for_(int jj = 0; jj < ur_w; jj++)
     for (int bci = 0; bci < ur_bc; bci++) {
-        const auto accvr = vreg(reg_ind(0, bci, jj, ur_bc, ur_w)).d;
-        mov(accvr, vmm_tmp.d);
-
-        if (jpp.is_training) {
-            const auto indvr = vreg(reg_ind(2, bci, jj, ur_bc, ur_w)).d;
+        const auto accvr = vreg(reg_ind(0, bci, jj, ur_bc, ur_w));
+        uni_orr(accvr, vmm_tmp, vmm_tmp);
 
-            eor(indvr, indvr, indvr);
-        }
+        if (jpp.is_training) uni_clear(vreg(reg_ind(2, bci, jj, ur_bc, ur_w)));
     }
     if (jpp.is_training) dup(vmm_k_offset, reg_k_shift);
     if (jpp.ndims == 5) {
@@ -646,22 +803,16 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
                             nstl::max(0, ki + pad_r - (kw - 1)), stride_w);
             for_(int jj = jj_start; jj < jj_end; jj++)
             for (int bci = 0; bci < ur_bc; bci++) {
-                const auto accvr = vreg(reg_ind(0, bci, jj, ur_bc, ur_w)).s;
+                const auto accr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
                 const auto inpr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
-                const auto inpvr = vreg(inpr_i).s;
-                const auto indvr = vreg(reg_ind(2, bci, jj, ur_bc, ur_w)).s;
+                const auto indr_i = reg_ind(2, bci, jj, ur_bc, ur_w);
                 int aux_input_offset
                         = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
-                load(reg_idx(inpr_i), aux_reg_input, input_offset,
+                load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, input_offset,
                         is_tail_processing(bci));
-
-                fcmlt(k_store_mask.s, P_ALL_ONE / T_z, accvr, inpvr);
-                sel(accvr, k_store_mask / T_m, inpvr, accvr);
-                if (jpp.is_training) {
-                    sel(indvr, k_store_mask / T_m, vmm_k_offset, indvr);
-                }
+                update_max(reg_idx(accr_i), reg_idx(inpr_i), reg_idx(indr_i));
             }
             if (jpp.is_training) add(vmm_k_offset, vmm_k_offset, vmm_one);
         }
@@ -696,7 +847,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
     for (int bci = 0; bci < ur_bc; bci++) {
         const auto accr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
         const auto output_offset = jpp.dt_size * (jj * c_off + bci * c_block);
-        store(reg_idx(accr_i), reg_output, output_offset,
+        store(jpp.src_dt, reg_idx(accr_i), reg_output, output_offset,
                 is_tail_processing(bci));
 
         if (jpp.is_training) {
@@ -704,26 +855,8 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
                     * types::data_type_size(jpp.ind_dt);
 
             const auto indr_i = reg_ind(2, bci, jj, ur_bc, ur_w);
-            auto vr = vreg(indr_i);
-            if (jpp.ind_dt == data_type::u8) {
-                add_imm(X_DEFAULT_ADDR, reg_index, step_index, X_TMP_0);
-                if (is_tail_processing(bci)) {
-                    if (jpp.is_c_padded) {
-                        mov(vr.s, k_c_tail_mask_s_not / T_m, 0);
-                        umin(vr.s, 255);
-                        st1b(vr.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
-                    } else {
-                        umin(vr.s, 255);
-                        st1b(vr.s, k_c_tail_mask_s, ptr(X_DEFAULT_ADDR));
-                    }
-                } else {
-                    umin(vr.s, 255);
-                    st1b(vr.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
-                }
-            } else {
-                store(vr.getIdx(), reg_index, step_index,
-                        is_tail_processing(bci));
-            }
+            store(jpp.ind_dt, reg_idx(indr_i), reg_index, step_index,
+                    is_tail_processing(bci));
         }
     }
 }
@@ -748,24 +881,14 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
     for (int bci = 0; bci < ur_bc; bci++) {
         const auto outr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
         auto out_offset = jpp.dt_size * (jj * c_off + bci * c_block);
-        load(reg_idx(outr_i), reg_output, out_offset, is_tail_processing(bci));
+        load(jpp.src_dt, reg_idx(outr_i), reg_output, out_offset,
+                is_tail_processing(bci));
         const size_t step_index = (jj * c_off + bci * c_block)
                 * types::data_type_size(jpp.ind_dt);
 
         const auto indr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
-        auto indvr = vreg(indr_i);
-        if (jpp.ind_dt == data_type::u8) {
-            if (is_tail_processing(bci) && !jpp.is_c_padded) {
-                add_imm(X_DEFAULT_ADDR, reg_index, step_index, X_TMP_0);
-                ld1b(indvr.s, k_c_tail_mask_s / T_z, ptr(X_DEFAULT_ADDR));
-            } else {
-                add_imm(X_DEFAULT_ADDR, reg_index, step_index, X_TMP_0);
-                ld1b(indvr.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
-            }
-        } else {
-            load(indvr.getIdx(), reg_index, step_index,
-                    is_tail_processing(bci));
-        }
+        load(jpp.ind_dt, reg_idx(indr_i), reg_index, step_index,
+                is_tail_processing(bci));
     }
     dup(vmm_k_offset, reg_k_shift);
 
@@ -792,19 +915,18 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
                             nstl::max(0, ki + pad_r - (kw - 1)), stride_w);
             for_(int jj = jj_start; jj < jj_end; jj++)
             for (int bci = 0; bci < ur_bc; bci++) {
-                const auto outvr = vreg(reg_ind(0, bci, jj, ur_bc, ur_w));
-                const auto indvr = vreg(reg_ind(1, bci, jj, ur_bc, ur_w)).s;
+                const auto outr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
+                const auto indr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
                 const auto inpr_i = reg_ind(2, bci, jj, ur_bc, ur_w);
-                const auto inpvr = vreg(inpr_i).s;
                 int aux_inp_offset
                         = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
                 if (aux_inp_offset >= iw * c_off) continue;
                 int inp_offset = jpp.dt_size * aux_inp_offset;
-                load(reg_idx(inpr_i), aux_reg_input, inp_offset,
+                load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, inp_offset,
                         is_tail_processing(bci));
-                cmpeq(k_store_mask.s, P_ALL_ONE / T_z, indvr, vmm_k_offset);
-                fadd(inpvr, k_store_mask / T_m, outvr.s);
-                store(inpvr.getIdx(), aux_reg_input, inp_offset,
+                accumulate_diff(
+                        reg_idx(inpr_i), reg_idx(outr_i), reg_idx(indr_i));
+                store(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, inp_offset,
                         is_tail_processing(bci));
             }
 
@@ -855,7 +977,7 @@ void jit_uni_pool_kernel<isa>::zero_diff_src(
     ldr(reg_zero_ptr, ptr(reg_param, GET_OFF(zero_ptr)));
 
     TReg vzero = vmm_tmp;
-    eor(vzero.d, vzero.d, vzero.d);
+    uni_clear(vzero);
 
     const int width_size = jpp.iw * c_off * jpp.dt_size;
 
@@ -873,7 +995,7 @@ void jit_uni_pool_kernel<isa>::zero_diff_src(
             for_(int i = 0; i < width_size; i += step)
             for (int bci = 0; bci < ur_bc; bci++) {
                 const int offs = i + bci * jpp.c_block * jpp.dt_size;
-                store(vzero.getIdx(), reg_zero_ptr, offs,
+                store(jpp.src_dt, vzero.getIdx(), reg_zero_ptr, offs,
                         is_tail_processing(bci));
             }
             add_imm(reg_zero_ptr, reg_zero_ptr, width_size, X_TMP_0);
@@ -896,7 +1018,7 @@ void jit_uni_pool_kernel<isa>::generate() {
 
     size_t simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
 
-    if (simd_w_ != cpu_sveLen / sizeof(float))
+    if (isa != asimd && simd_w_ != cpu_sveLen / sizeof(float))
         set_preg(P_ALL_ONE.s, simd_w_, X_TMP_0, X_TMP_1);
 
     Label idx_table;
@@ -911,7 +1033,7 @@ void jit_uni_pool_kernel<isa>::generate() {
     const int c_off
             = (jpp.tag_kind == jit_memory_tag_kind_t::nspc) ? jpp.c : c_block;
 
-    pfalse(p_all_zero.b);
+    if (isa != asimd) pfalse(p_all_zero.b);
 
     ldr(reg_input, ptr(reg_param, GET_OFF(src)));
     ldr(reg_output, ptr(reg_param, GET_OFF(dst)));
@@ -963,7 +1085,8 @@ void jit_uni_pool_kernel<isa>::generate() {
 
         if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward)) {
             // The same situation as above(vmm_ker_area_h).
-            dup(vmm_one, 1);
+            mov_imm(W_TMP_0, 1);
+            dup(vmm_one, W_TMP_0);
         }
 
         const int ur_w = nstl::min(jpp.ow, jpp.ur / jpp.ur_bc);
@@ -1056,12 +1179,13 @@ void jit_uni_pool_kernel<isa>::generate() {
 
     this->postamble();
 
-    if (jpp.with_eltwise && postops_injector_)
-        postops_injector_->prepare_table();
+    prepare_postops_table();
 }
 
 template struct jit_uni_pool_kernel<sve_512>;
 template struct jit_uni_pool_kernel<sve_256>;
+template struct jit_uni_pool_kernel<sve_128>;
+template struct jit_uni_pool_kernel<asimd>;
 
 } // namespace aarch64
 } // namespace cpu
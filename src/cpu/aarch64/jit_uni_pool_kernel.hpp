@@ -87,7 +87,7 @@ private:
             return 4;
     }
 
-    ZReg z_tmp0 = z4;
+    TReg z_tmp0 = TReg(4);
 
     PReg k_c_tail_mask_s = p4;
     PReg k_c_tail_mask_s_not = p2;
@@ -127,10 +127,10 @@ private:
     void prepare_tail_mask();
     void push_vmm_val(const int idx);
     void pop_vmm_val(const int idx);
-    void load(const int idx, const xreg_t &reg_ptr, const int offset,
-            const bool is_c_tail_proccessing);
-    void store(const int idx, const xreg_t &reg_ptr, const int offset,
-            const bool is_c_tail_proccessing);
+    void load(const data_type_t dt, const int idx, const xreg_t &reg_ptr,
+            const int offset, const bool is_c_tail_proccessing);
+    void store(const data_type_t dt, const int idx, const xreg_t &reg_ptr,
+            const int offset, const bool is_c_tail_proccessing);
 
     void maybe_recalculate_divisor(int jj, int ur_w, int pad_l, int pad_r,
             bool with_c_tail_proccessing);
@@ -141,6 +141,10 @@ private:
     void max_step_bwd(int ur_w, int ur_bc, int pad_l, int pad_r,
             bool with_c_tail_proccessing);
 
+    void update_max(const int acc_idx, const int inp_idx, const int ind_idx);
+    void accumulate_diff(
+            const int inp_idx, const int out_idx, const int ind_idx);
+
     void zero_diff_src(int ur_bc, bool with_c_tail_proccessing);
 
     void step(int ur_w, int ur_bc, int pad_l, int pad_r,
@@ -160,6 +164,7 @@ private:
 
     void apply_postops(int ur_bc, int ur_w, int c_block,
             const std::function<bool(int)> &is_tail_predicate);
+    void prepare_postops_table();
 
     static bool post_ops_ok(jit_pool_conf_t &jpp, const primitive_attr_t &attr,
             const memory_desc_wrapper &dst_d);
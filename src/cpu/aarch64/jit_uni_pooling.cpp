@@ -1267,8 +1267,28 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
 
 template struct jit_uni_pooling_fwd_t<sve_512, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<sve_512, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<sve_512, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<sve_512, data_type::bf16>;
+template struct jit_uni_pooling_fwd_t<sve_512, data_type::f16>;
+template struct jit_uni_pooling_bwd_t<sve_512, data_type::f16>;
 template struct jit_uni_pooling_fwd_t<sve_256, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<sve_256, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<sve_256, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<sve_256, data_type::bf16>;
+template struct jit_uni_pooling_fwd_t<sve_256, data_type::f16>;
+template struct jit_uni_pooling_bwd_t<sve_256, data_type::f16>;
+template struct jit_uni_pooling_fwd_t<sve_128, data_type::f32>;
+template struct jit_uni_pooling_bwd_t<sve_128, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<sve_128, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<sve_128, data_type::bf16>;
+template struct jit_uni_pooling_fwd_t<sve_128, data_type::f16>;
+template struct jit_uni_pooling_bwd_t<sve_128, data_type::f16>;
+template struct jit_uni_pooling_fwd_t<asimd, data_type::f32>;
+template struct jit_uni_pooling_bwd_t<asimd, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<asimd, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<asimd, data_type::bf16>;
+template struct jit_uni_pooling_fwd_t<asimd, data_type::f16>;
+template struct jit_uni_pooling_bwd_t<asimd, data_type::f16>;
 
 } // namespace aarch64
 } // namespace cpu
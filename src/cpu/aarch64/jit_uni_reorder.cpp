@@ -446,13 +446,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             add_imm(x_tmp_vec[i], x_tmp_vec[i - 1],
                     otype_sz_ * node_1_output_stride, X_DEFAULT_ADDR);
         for (uint32_t i = 0; i < 4; i++)
-            st1w(ZRegS {i}, p_size / T_z, ptr(x_tmp_vec[i]));
+            store_z(ZRegS {i}, p_size, x_tmp_vec[i]);
         for (int i = 0; i < unroll / 2; i++)
             add_imm(x_tmp_vec[i], x_tmp_vec[(i + 3) % 4],
                     otype_sz_ * node_1_output_stride, X_DEFAULT_ADDR);
 
         for (uint32_t i = 0; i < unroll / 2; i++)
-            st1w(ZRegS {4 + i}, p_size / T_z, ptr(x_tmp_vec[i]));
+            store_z(ZRegS {4 + i}, p_size, x_tmp_vec[i]);
     }
 
     bool can_do_tr8x8() {
@@ -609,8 +609,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
                 for (int i = 0; i < count; i++) {
                     if (vlen == 64 || vlen == 32)
-                        st1w(ZRegS(tmp_ur + i), p_lsb_256 / T_z,
-                                ptr(x_tmp_vec[i]));
+                        store_z(ZRegS(tmp_ur + i), p_lsb_256, x_tmp_vec[i]);
                     else if (vlen == 16)
                         str(QReg(tmp_ur + i), ptr(x_tmp_vec[i]));
                     else
@@ -703,6 +702,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         auto store = [=](const XReg &addr, const VReg ymm, int size) {
             const uint32_t xmm = ymm.getIdx();
+            if (prb_.use_nt_stores && get_sve_length() && size >= 8) {
+                store_z(ZRegS(xmm), size == 16 ? p_lsb_128 : p_lsb_64, addr);
+                return;
+            }
             switch (size) {
                 case 16: str(QReg(xmm), ptr(addr)); break;
                 case 8: str(DReg(xmm), ptr(addr)); break;
@@ -1317,6 +1320,14 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         }
     }
 
+    // Stores the lanes of `p`, bypassing the caches if the output is large.
+    void store_z(const ZRegS &z, const PReg &p, const XReg &addr) {
+        if (prb_.use_nt_stores)
+            stnt1w(z, p, ptr(addr));
+        else
+            st1w(z, p / T_z, ptr(addr));
+    }
+
     static bool interim_f32_needed(const prb_t &prb, bool compensation_needed) {
         using namespace data_type;
         bool ret = utils::one_of(f32, prb.itype, prb.otype)
@@ -2198,7 +2209,12 @@ struct jit_single_blk_kernel_t : public jit_generator {
     void gen_storeu(const XReg &addr, const ZRegS ymm, int size) {
         QReg xmm(ymm.getIdx());
         switch (size) {
-            case 32: st1w(ymm, p_lsb_256, ptr(addr)); break;
+            case 32:
+                if (prb_.use_nt_stores)
+                    stnt1w(ymm, p_lsb_256, ptr(addr));
+                else
+                    st1w(ymm, p_lsb_256, ptr(addr));
+                break;
             case 16: str(xmm, ptr(addr)); break;
             default: assert(!"unreachable");
         }
@@ -2217,7 +2233,12 @@ struct jit_single_blk_kernel_t : public jit_generator {
             const XReg &addr, const ZRegS ymm, const PReg mask, int size) {
         switch (size) {
             case 32:
-            case 16: st1w(ymm, mask, ptr(addr)); break;
+            case 16:
+                if (prb_.use_nt_stores)
+                    stnt1w(ymm, mask, ptr(addr));
+                else
+                    st1w(ymm, mask, ptr(addr));
+                break;
             default: assert(!"unreachable");
         }
     }
@@ -123,6 +123,7 @@ struct prb_t {
     bool req_asymmetric_comp = false;
     bool req_src_zp = false;
     bool req_dst_zp = false;
+    bool use_nt_stores = false;
 };
 
 status_t prb_init(prb_t &prb, const memory_desc_t &imd,
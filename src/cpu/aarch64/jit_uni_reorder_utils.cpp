@@ -27,6 +27,8 @@
 #include "common/utils.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/aarch64/jit_uni_reorder.hpp"
 
 // #define DNNL_DEV_MODE
@@ -425,6 +427,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
 
     const int sum_idx = attr->post_ops_.find(primitive_kind::sum);
     p.beta = sum_idx == -1 ? 0.f : attr->post_ops_.entry_[sum_idx].sum.scale;
+    p.use_nt_stores = platform::use_nt_stores(om_d.size());
 
     DEBUG({
         verbose_printf(
@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/aarch64/jit_uni_sum.hpp"
+
+#define GET_OFF(field) offsetof(jit_sum_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+jit_uni_sum_kernel_t<isa>::jit_uni_sum_kernel_t(const jit_sum_conf_t &conf)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true), conf_(conf) {}
+
+template <cpu_isa_t isa>
+XReg jit_uni_sum_kernel_t<isa>::reg_src(int i) const {
+    // x18 is the platform register, x21 and above are used by the generator.
+    return i < 14 ? XReg(4 + i) : XReg(19 + i - 14);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::load(
+        const TReg &v, const XReg &base, data_type_t dt) {
+    switch (dt) {
+        case data_type::f32:
+            ld1w(v.s, p_lanes / T_z, ptr(base, reg_idx, LSL, 2));
+            break;
+        case data_type::bf16:
+            // bf16 is the upper half of f32
+            ld1h(v.s, p_lanes / T_z, ptr(base, reg_idx, LSL, 1));
+            lsl(v.s, v.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(v.s, p_lanes / T_z, ptr(base, reg_idx, LSL, 1));
+            fcvt(v.s, p_lanes / T_m, v.h);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::store(
+        const TReg &v, const XReg &base, data_type_t dt) {
+    switch (dt) {
+        case data_type::f32:
+            st1w(v.s, p_lanes, ptr(base, reg_idx, LSL, 2));
+            break;
+        case data_type::bf16:
+            bfcvt(v.h, p_lanes / T_m, v.s);
+            st1h(v.s, p_lanes, ptr(base, reg_idx, LSL, 1));
+            break;
+        case data_type::f16:
+            fcvt(v.h, p_lanes / T_m, v.s);
+            st1h(v.s, p_lanes, ptr(base, reg_idx, LSL, 1));
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::generate() {
+    preamble();
+
+    if (simd_w_ != cpu_sveLen / sizeof(float))
+        set_preg(P_ALL_ONE.s, simd_w_, X_TMP_0, X_TMP_1);
+
+    const int n = conf_.num_srcs;
+    for (int i = 0; i < n; i++) {
+        add_imm(X_DEFAULT_ADDR, reg_param,
+                GET_OFF(srcs) + i * sizeof(const void *), X_TMP_0);
+        ldr(reg_src(i), ptr(X_DEFAULT_ADDR));
+        // Unit scales are applied with plain additions.
+        if (conf_.scales[i] != 1.f)
+            init_vmm(vscale(i), X_TMP_0, conf_.scales[i]);
+    }
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(dst), X_TMP_0);
+    ldr(reg_dst, ptr(X_DEFAULT_ADDR));
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(len), X_TMP_0);
+    ldr(reg_len, ptr(X_DEFAULT_ADDR));
+
+    Label vec_loop, vec_loop_end;
+
+    mov_imm(reg_idx, 0);
+    L(vec_loop);
+    {
+        cmp(reg_idx, reg_len);
+        b(GE, vec_loop_end);
+
+        // The last iteration processes the tail with a partial predicate
+        whilelt(p_lanes.s, reg_idx, reg_len);
+        and_(p_lanes.b, P_ALL_ONE / T_z, p_lanes.b, p_lanes.b);
+
+        for (int i = 0; i < n; i++) {
+            const bool unit_scale = conf_.scales[i] == 1.f;
+            const TReg &v = i == 0 && unit_scale ? vacc : vtmp;
+            load(v, reg_src(i), conf_.src_dt[i]);
+            if (i == 0) {
+                if (!unit_scale) fmul(vacc.s, vtmp.s, vscale(i).s);
+            } else if (unit_scale) {
+                fadd(vacc.s, vacc.s, vtmp.s);
+            } else {
+                fmla(vacc.s, P_ALL_ONE / T_m, vtmp.s, vscale(i).s);
+            }
+        }
+        store(vacc, reg_dst, conf_.dst_dt);
+
+        add_imm(reg_idx, reg_idx, simd_w_, X_TMP_0);
+        b(vec_loop);
+    }
+    L(vec_loop_end);
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_SUM(cpu_sum_pd_t::init(engine) == status::success,
+            VERBOSE_BAD_ENGINE_KIND);
+
+    const int n = n_inputs();
+    VDISPATCH_SUM(n <= jit_sum_conf_t::max_num_arrs,
+            "number of inputs exceed max number of arrays");
+
+    const memory_desc_wrapper o_d(dst_md());
+    VDISPATCH_SUM(utils::one_of(o_d.data_type(), f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SUM(IMPLICATION(o_d.data_type() == bf16, mayiuse_bf16()),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_SUM(o_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    conf_.num_srcs = n;
+    conf_.dst_dt = o_d.data_type();
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        VDISPATCH_SUM(utils::one_of(i_d.data_type(), f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SUM(o_d.similar_to(i_d, true, false, 0),
+                VERBOSE_INCONSISTENT_MDS, "o_d", "i_d");
+        VDISPATCH_SUM(i_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        conf_.src_dt[i] = i_d.data_type();
+        conf_.scales[i] = scales()[i];
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, new jit_uni_sum_kernel_t<isa>(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    dst += o_d.offset0() * o_d.data_type_size();
+
+    const char *srcs[jit_sum_conf_t::max_num_arrs];
+    for (int i = 0; i < conf.num_srcs; i++) {
+        const memory_desc_wrapper i_d(pd()->src_md(i));
+        srcs[i] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i)
+                + i_d.offset0() * i_d.data_type_size();
+    }
+
+    // Threads get whole blocks to keep the stores of different threads on
+    // different cache lines.
+    const dim_t nelems = o_d.nelems(true);
+    const dim_t block = platform::get_cache_line_size();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(utils::div_up(nelems, block), nthr, ithr, start, end);
+        start = nstl::min(nelems, start * block);
+        end = nstl::min(nelems, end * block);
+        if (start == end) return;
+
+        jit_sum_call_s args;
+        for (int i = 0; i < conf.num_srcs; i++)
+            args.srcs[i] = srcs[i]
+                    + start * types::data_type_size(conf.src_dt[i]);
+        args.dst = dst + start * o_d.data_type_size();
+        args.len = end - start;
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_kernel_t<sve_512>;
+template struct jit_uni_sum_kernel_t<sve_256>;
+template struct jit_uni_sum_kernel_t<sve_128>;
+template struct jit_uni_sum_t<sve_512>;
+template struct jit_uni_sum_t<sve_256>;
+template struct jit_uni_sum_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
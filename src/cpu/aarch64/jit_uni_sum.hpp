@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_SUM_HPP
+#define CPU_AARCH64_JIT_UNI_SUM_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_sum_conf_t {
+    // Every input pointer and scale lives in a register of its own.
+    static constexpr int max_num_arrs = 16;
+
+    int num_srcs;
+    data_type_t src_dt[max_num_arrs];
+    float scales[max_num_arrs];
+    data_type_t dst_dt;
+};
+
+struct jit_sum_call_s {
+    const void *srcs[jit_sum_conf_t::max_num_arrs];
+    void *dst;
+    size_t len; // number of elements
+};
+
+// dst = sum(scales[i] * srcs[i]), the inputs are converted to f32 and
+// accumulated in f32 before the conversion to the destination data type.
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    jit_uni_sum_kernel_t(const jit_sum_conf_t &conf);
+
+private:
+    using XReg = Xbyak_aarch64::XReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void generate() override;
+    void load(const TReg &v, const XReg &base, data_type_t dt);
+    void store(const TReg &v, const XReg &base, data_type_t dt);
+    XReg reg_src(int i) const;
+    TReg vscale(int i) const { return TReg(16 + i); }
+
+    const jit_sum_conf_t conf_;
+
+    const XReg reg_param = abi_param1;
+    const XReg reg_dst = x1;
+    const XReg reg_len = x2;
+    const XReg reg_idx = x3;
+
+    const PReg p_lanes = p1;
+
+    const TReg vacc = TReg(0);
+    const TReg vtmp = TReg(1);
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine);
+
+        jit_sum_conf_t conf_;
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_sum_kernel_t<isa>> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,513 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/lrn/jit_uni_lrn.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Offset of channel `c` of spatial point `sp` within a single image of a
+// nspc or blocked tensor.
+inline dim_t ch_off(const jit_lrn_conf_t &conf, dim_t c, dim_t sp) {
+    const dim_t SP = conf.D * conf.H * conf.W;
+    return (c / conf.blk) * SP * conf.blk + sp * conf.blk + c % conf.blk;
+}
+
+// Number of channel blocks and channels per block of nspc and blocked tensors
+// as seen by the within channel kernels.
+inline dim_t nb_c(const jit_lrn_conf_t &conf) {
+    return div_up(conf.C, conf.blk);
+}
+
+inline jit_lrn_call_s make_args(const float *ws, const float *src,
+        const float *diff_dst, float *dst, float *tmp, dim_t len, dim_t cnt0,
+        dim_t stride0, dim_t cnt1, dim_t stride1) {
+    jit_lrn_call_s args;
+    args.ws = ws;
+    args.src = src;
+    args.diff_dst = diff_dst;
+    args.dst = dst;
+    args.tmp = tmp;
+    args.len = len;
+    args.cnt0 = cnt0;
+    args.stride0 = stride0 * sizeof(float);
+    args.cnt1 = cnt1;
+    args.stride1 = stride1 * sizeof(float);
+    return args;
+}
+
+// Sizes of the per thread buffers, in floats.
+dim_t thread_buffer_size(const jit_lrn_conf_t &conf, bool is_fwd) {
+    const dim_t C_pad = conf.C + 2 * conf.half;
+    const dim_t PW = conf.W + 2 * conf.half;
+    if (conf.across_channels) {
+        switch (conf.layout) {
+            case lrn_layout_t::ncsp:
+                return is_fwd ? 0 : 2 * conf.C * conf.sp_chunk;
+            case lrn_layout_t::nspc:
+            case lrn_layout_t::blocked:
+                return is_fwd ? C_pad + conf.C : 2 * C_pad + 3 * conf.C;
+        }
+    } else if (conf.layout == lrn_layout_t::ncsp) {
+        return is_fwd ? conf.H * PW : 2 * conf.H * PW + conf.H * conf.W;
+    }
+    return 0;
+}
+
+} // namespace
+
+status_t init_lrn_conf(jit_lrn_conf_t &conf, const lrn_pd_t *pd) {
+    const memory_desc_wrapper src_d(pd->src_md());
+    const int ndims = pd->ndims();
+    const auto desc = pd->desc();
+
+    conf.across_channels = desc->alg_kind == alg_kind::lrn_across_channels;
+    conf.N = pd->MB();
+    conf.C = pd->C();
+    conf.D = pd->D();
+    conf.H = pd->H();
+    conf.W = pd->W();
+
+    const auto tag = src_d.matches_one_of_tag(ncw, nchw, ncdhw, nwc, nhwc,
+            ndhwc, nCw8c, nChw8c, nCdhw8c, nCw16c, nChw16c, nCdhw16c);
+    if (tag == format_tag::undef) return status::unimplemented;
+
+    if (one_of(tag, ncw, nchw, ncdhw)) {
+        conf.layout = lrn_layout_t::ncsp;
+        conf.blk = 1;
+    } else if (one_of(tag, nwc, nhwc, ndhwc)) {
+        conf.layout = lrn_layout_t::nspc;
+        conf.blk = conf.C;
+    } else {
+        conf.layout = lrn_layout_t::blocked;
+        conf.blk = one_of(tag, nCw8c, nChw8c, nCdhw8c) ? 8 : 16;
+    }
+
+    // Within channel normalization walks a two dimensional window only.
+    if (!conf.across_channels && ndims == 5) return status::unimplemented;
+
+    const dim_t size = desc->local_size;
+    dim_t n_summands = size;
+    if (!conf.across_channels)
+        for (int d = 2; d < ndims - 1; ++d)
+            n_summands *= size;
+
+    conf.half = (size - 1) / 2;
+    conf.sp_chunk = nstl::min(conf.D * conf.H * conf.W, (dim_t)256);
+    conf.alpha = desc->lrn_alpha / n_summands;
+    conf.beta = desc->lrn_beta;
+    conf.k = desc->lrn_k;
+
+    return status::success;
+}
+
+void init_lrn_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_lrn_conf_t &conf, bool is_fwd) {
+    const dim_t thr_size = thread_buffer_size(conf, is_fwd);
+    if (thr_size > 0)
+        scratchpad.book<float>(
+                key_lrn_buffer, thr_size * dnnl_get_max_threads());
+
+    // Within channel backward of nspc and blocked tensors keeps the terms to
+    // be reduced for the whole tensor.
+    if (!is_fwd && !conf.across_channels && conf.layout != lrn_layout_t::ncsp)
+        scratchpad.book<float>(key_lrn_tmp,
+                conf.N * nb_c(conf) * conf.blk * conf.D * conf.H * conf.W);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_LRN(is_fwd(), VERBOSE_BAD_PROPKIND);
+
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_LRN(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_LRN(everyone_is(f32, src_d.data_type(), dst_d.data_type()),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LRN(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_LRN(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_LRN(src_d == dst_d, VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    VDISPATCH_LRN(one_of(ndims(), 3, 4, 5), VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_LRN(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_LRN(init_lrn_conf(conf_, this) == status::success,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    init_lrn_scratchpad(scratchpad, conf_, true);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::init(engine_t *engine) {
+    const auto &conf = pd()->conf_;
+    CHECK(safe_ptr_assign(ker_,
+            new jit_uni_lrn_kernel_t<isa>(
+                    lrn_kernel_kind_t::fwd, conf.alpha, conf.k, conf.beta)));
+    return ker_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    src += src_d.offset0();
+    dst += src_d.offset0();
+
+    const auto &conf = pd()->conf_;
+    const auto &ker = *ker_;
+    const dim_t C = conf.C, H = conf.H, W = conf.W;
+    const dim_t SP = conf.D * H * W;
+    const dim_t half = conf.half, win = 2 * half + 1;
+    const dim_t C_pad = C + 2 * half, PW = W + 2 * half;
+    const dim_t thr_size = thread_buffer_size(conf, true);
+    const dim_t img_size = nb_c(conf) * conf.blk * SP;
+    float *wsp = ctx.get_scratchpad_grantor().template get<float>(
+            key_lrn_buffer);
+
+    if (conf.across_channels && conf.layout == lrn_layout_t::ncsp) {
+        parallel_nd(conf.N, C, [&](dim_t n, dim_t c) {
+            const dim_t c_st = nstl::max(c - half, (dim_t)0);
+            const dim_t c_en = nstl::min(c + half + 1, C);
+            const float *s = src + n * C * SP;
+            auto args = make_args(s + c_st * SP, s + c * SP, nullptr,
+                    dst + (n * C + c) * SP, nullptr, SP, c_en - c_st, SP, 1,
+                    1);
+            ker(&args);
+        });
+    } else if (conf.across_channels) {
+        // Every channel row is copied to a zero padded buffer, so that the
+        // window of every lane has the same shape.
+        const bool is_nspc = conf.layout == lrn_layout_t::nspc;
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *src_pad = wsp + ithr * thr_size;
+            float *dst_row = src_pad + C_pad;
+            std::memset(src_pad, 0, C_pad * sizeof(float));
+            for_nd(ithr, nthr, conf.N, SP, [&](dim_t n, dim_t sp) {
+                const float *s = src + n * img_size;
+                float *d = dst + n * img_size;
+                if (is_nspc) {
+                    std::memcpy(src_pad + half, s + sp * C, C * sizeof(float));
+                } else {
+                    for (dim_t c = 0; c < C; c++)
+                        src_pad[half + c] = s[ch_off(conf, c, sp)];
+                }
+                auto args = make_args(src_pad, src_pad + half, nullptr,
+                        is_nspc ? d + sp * C : dst_row, nullptr, C, 1, 0, win,
+                        1);
+                ker(&args);
+                if (!is_nspc) {
+                    for (dim_t c = 0; c < C; c++)
+                        d[ch_off(conf, c, sp)] = dst_row[c];
+                }
+            });
+        });
+    } else if (conf.layout == lrn_layout_t::ncsp) {
+        // Every plane is copied to a buffer padded along the width, the
+        // window is clipped along the height.
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *src_pad = wsp + ithr * thr_size;
+            std::memset(src_pad, 0, H * PW * sizeof(float));
+            for_nd(ithr, nthr, conf.N, C, [&](dim_t n, dim_t c) {
+                const float *s = src + (n * C + c) * SP;
+                float *d = dst + (n * C + c) * SP;
+                for (dim_t h = 0; h < H; h++)
+                    std::memcpy(src_pad + h * PW + half, s + h * W,
+                            W * sizeof(float));
+                for (dim_t h = 0; h < H; h++) {
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    auto args = make_args(src_pad + h_st * PW, s + h * W,
+                            nullptr, d + h * W, nullptr, W, h_en - h_st, PW,
+                            win, 1);
+                    ker(&args);
+                }
+            });
+        });
+    } else {
+        // Channels are the innermost dimension, the window is clipped along
+        // both spatial dimensions.
+        const dim_t blk = conf.blk;
+        const dim_t len = conf.layout == lrn_layout_t::nspc ? C : blk;
+        parallel_nd(conf.N, nb_c(conf), H, W,
+                [&](dim_t n, dim_t cb, dim_t h, dim_t w) {
+                    const dim_t off = (n * nb_c(conf) + cb) * SP * blk;
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    const dim_t w_st = nstl::max(w - half, (dim_t)0);
+                    const dim_t w_en = nstl::min(w + half + 1, W);
+                    const dim_t pix = (h * W + w) * blk;
+                    auto args = make_args(src + off + (h_st * W + w_st) * blk,
+                            src + off + pix, nullptr, dst + off + pix, nullptr,
+                            len, h_en - h_st, W * blk, w_en - w_st, blk);
+                    ker(&args);
+                });
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper diff_src_d(diff_src_md());
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+    VDISPATCH_LRN(!is_fwd(), VERBOSE_BAD_PROPKIND);
+
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_LRN(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_LRN(everyone_is(f32, src_d.data_type(), diff_src_d.data_type(),
+                          diff_dst_d.data_type()),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LRN(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_LRN(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_LRN(src_d == diff_dst_d, VERBOSE_INCONSISTENT_MDS, "src",
+            "diff_dst");
+    VDISPATCH_LRN(diff_src_d == diff_dst_d, VERBOSE_INCONSISTENT_MDS,
+            "diff_src", "diff_dst");
+    VDISPATCH_LRN(one_of(ndims(), 3, 4, 5), VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_LRN(impl::is_dense_format_kind(
+                          {src_md(), diff_src_md(), diff_dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_LRN(init_lrn_conf(conf_, this) == status::success,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    init_lrn_scratchpad(scratchpad, conf_, false);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::init(engine_t *engine) {
+    const auto &conf = pd()->conf_;
+    CHECK(safe_ptr_assign(ker_scale_,
+            new jit_uni_lrn_kernel_t<isa>(lrn_kernel_kind_t::bwd_scale,
+                    conf.alpha, conf.k, conf.beta)));
+    CHECK(safe_ptr_assign(ker_reduce_,
+            new jit_uni_lrn_kernel_t<isa>(lrn_kernel_kind_t::bwd_reduce,
+                    conf.alpha, conf.k, conf.beta)));
+    CHECK(ker_scale_->create_kernel());
+    return ker_reduce_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    src += src_d.offset0();
+    diff_dst += src_d.offset0();
+    diff_src += src_d.offset0();
+
+    const auto &conf = pd()->conf_;
+    const auto &ker_scale = *ker_scale_;
+    const auto &ker_reduce = *ker_reduce_;
+    const dim_t C = conf.C, H = conf.H, W = conf.W;
+    const dim_t SP = conf.D * H * W;
+    const dim_t half = conf.half, win = 2 * half + 1;
+    const dim_t C_pad = C + 2 * half, PW = W + 2 * half;
+    const dim_t thr_size = thread_buffer_size(conf, false);
+    const dim_t img_size = nb_c(conf) * conf.blk * SP;
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *wsp = scratchpad.template get<float>(key_lrn_buffer);
+
+    if (conf.across_channels && conf.layout == lrn_layout_t::ncsp) {
+        // The scaled diff_dst and the terms to be reduced are kept for a
+        // chunk of spatial points of all the channels.
+        const dim_t L = conf.sp_chunk;
+        const dim_t nb_sp = div_up(SP, L);
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *a = wsp + ithr * thr_size;
+            float *t = a + C * L;
+            for_nd(ithr, nthr, conf.N, nb_sp, [&](dim_t n, dim_t spb) {
+                const dim_t sp = spb * L;
+                const dim_t len = nstl::min(L, SP - sp);
+                const dim_t off = n * C * SP + sp;
+                for (dim_t c = 0; c < C; c++) {
+                    const dim_t c_st = nstl::max(c - half, (dim_t)0);
+                    const dim_t c_en = nstl::min(c + half + 1, C);
+                    auto args = make_args(src + off + c_st * SP,
+                            src + off + c * SP, diff_dst + off + c * SP,
+                            a + c * L, t + c * L, len, c_en - c_st, SP, 1, 1);
+                    ker_scale(&args);
+                }
+                for (dim_t c = 0; c < C; c++) {
+                    const dim_t c_st = nstl::max(c - half, (dim_t)0);
+                    const dim_t c_en = nstl::min(c + half + 1, C);
+                    auto args = make_args(t + c_st * L, src + off + c * SP,
+                            a + c * L, diff_src + off + c * SP, nullptr, len,
+                            c_en - c_st, L, 1, 1);
+                    ker_reduce(&args);
+                }
+            });
+        });
+    } else if (conf.across_channels) {
+        const bool is_nspc = conf.layout == lrn_layout_t::nspc;
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *src_pad = wsp + ithr * thr_size;
+            float *t_pad = src_pad + C_pad;
+            float *a = t_pad + C_pad;
+            float *dd_row = a + C;
+            float *ds_row = dd_row + C;
+            std::memset(src_pad, 0, 2 * C_pad * sizeof(float));
+            for_nd(ithr, nthr, conf.N, SP, [&](dim_t n, dim_t sp) {
+                const float *s = src + n * img_size;
+                const float *dd = diff_dst + n * img_size;
+                float *ds = diff_src + n * img_size;
+                if (is_nspc) {
+                    std::memcpy(src_pad + half, s + sp * C, C * sizeof(float));
+                } else {
+                    for (dim_t c = 0; c < C; c++) {
+                        src_pad[half + c] = s[ch_off(conf, c, sp)];
+                        dd_row[c] = dd[ch_off(conf, c, sp)];
+                    }
+                }
+                auto args_scale = make_args(src_pad, src_pad + half,
+                        is_nspc ? dd + sp * C : dd_row, a, t_pad + half, C, 1,
+                        0, win, 1);
+                ker_scale(&args_scale);
+                auto args_reduce = make_args(t_pad, src_pad + half, a,
+                        is_nspc ? ds + sp * C : ds_row, nullptr, C, 1, 0, win,
+                        1);
+                ker_reduce(&args_reduce);
+                if (!is_nspc) {
+                    for (dim_t c = 0; c < C; c++)
+                        ds[ch_off(conf, c, sp)] = ds_row[c];
+                }
+            });
+        });
+    } else if (conf.layout == lrn_layout_t::ncsp) {
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *src_pad = wsp + ithr * thr_size;
+            float *t_pad = src_pad + H * PW;
+            float *a = t_pad + H * PW;
+            std::memset(src_pad, 0, 2 * H * PW * sizeof(float));
+            for_nd(ithr, nthr, conf.N, C, [&](dim_t n, dim_t c) {
+                const dim_t off = (n * C + c) * SP;
+                for (dim_t h = 0; h < H; h++)
+                    std::memcpy(src_pad + h * PW + half, src + off + h * W,
+                            W * sizeof(float));
+                for (dim_t h = 0; h < H; h++) {
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    auto args = make_args(src_pad + h_st * PW,
+                            src + off + h * W, diff_dst + off + h * W,
+                            a + h * W, t_pad + h * PW + half, W, h_en - h_st,
+                            PW, win, 1);
+                    ker_scale(&args);
+                }
+                for (dim_t h = 0; h < H; h++) {
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    auto args = make_args(t_pad + h_st * PW, src + off + h * W,
+                            a + h * W, diff_src + off + h * W, nullptr, W,
+                            h_en - h_st, PW, win, 1);
+                    ker_reduce(&args);
+                }
+            });
+        });
+    } else {
+        // The scaled diff_dst is kept in diff_src and the terms to be reduced
+        // in a tensor sized buffer, as every point needs them for its whole
+        // spatial window.
+        float *t = scratchpad.template get<float>(key_lrn_tmp);
+        const dim_t blk = conf.blk;
+        const dim_t len = conf.layout == lrn_layout_t::nspc ? C : blk;
+        const dim_t NB_C = nb_c(conf);
+        parallel_nd(conf.N, NB_C, H, W,
+                [&](dim_t n, dim_t cb, dim_t h, dim_t w) {
+                    const dim_t off = (n * NB_C + cb) * SP * blk;
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    const dim_t w_st = nstl::max(w - half, (dim_t)0);
+                    const dim_t w_en = nstl::min(w + half + 1, W);
+                    const dim_t pix = off + (h * W + w) * blk;
+                    auto args = make_args(src + off + (h_st * W + w_st) * blk,
+                            src + pix, diff_dst + pix, diff_src + pix, t + pix,
+                            len, h_en - h_st, W * blk, w_en - w_st, blk);
+                    ker_scale(&args);
+                });
+        parallel_nd(conf.N, NB_C, H, W,
+                [&](dim_t n, dim_t cb, dim_t h, dim_t w) {
+                    const dim_t off = (n * NB_C + cb) * SP * blk;
+                    const dim_t h_st = nstl::max(h - half, (dim_t)0);
+                    const dim_t h_en = nstl::min(h + half + 1, H);
+                    const dim_t w_st = nstl::max(w - half, (dim_t)0);
+                    const dim_t w_en = nstl::min(w + half + 1, W);
+                    const dim_t pix = off + (h * W + w) * blk;
+                    auto args = make_args(t + off + (h_st * W + w_st) * blk,
+                            src + pix, diff_src + pix, diff_src + pix, nullptr,
+                            len, h_en - h_st, W * blk, w_en - w_st, blk);
+                    ker_reduce(&args);
+                });
+    }
+
+    return status::success;
+}
+
+template struct jit_uni_lrn_fwd_t<sve_512>;
+template struct jit_uni_lrn_fwd_t<sve_256>;
+template struct jit_uni_lrn_fwd_t<sve_128>;
+template struct jit_uni_lrn_bwd_t<sve_512>;
+template struct jit_uni_lrn_bwd_t<sve_256>;
+template struct jit_uni_lrn_bwd_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
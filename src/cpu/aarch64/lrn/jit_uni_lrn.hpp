@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_LRN_JIT_UNI_LRN_HPP
+#define CPU_AARCH64_LRN_JIT_UNI_LRN_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_lrn_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/lrn/jit_uni_lrn_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Channel placement of the supported layouts:
+//   - ncsp:    nc[d][h]w, every channel is a contiguous spatial plane
+//   - nspc:    n[d][h]wc, channels are contiguous for every spatial point
+//   - blocked: nC[d][h]w8c and nC[d][h]w16c
+enum class lrn_layout_t { ncsp, nspc, blocked };
+
+struct jit_lrn_conf_t {
+    lrn_layout_t layout;
+    bool across_channels;
+    dim_t N, C, D, H, W;
+    dim_t blk; // channel block, C for nspc
+    dim_t half; // window half size, the window is [x - half, x + half]
+    dim_t sp_chunk; // spatial points per thread for ncsp across backward
+    float alpha; // alpha divided by the number of summands
+    float beta;
+    float k;
+};
+
+status_t init_lrn_conf(jit_lrn_conf_t &conf, const lrn_pd_t *pd);
+void init_lrn_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_lrn_conf_t &conf, bool is_fwd);
+
+template <cpu_isa_t isa>
+struct jit_uni_lrn_fwd_t : public primitive_t {
+    struct pd_t : public cpu_lrn_fwd_pd_t {
+        using cpu_lrn_fwd_pd_t::cpu_lrn_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_lrn_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_lrn_conf_t conf_;
+    };
+
+    jit_uni_lrn_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_lrn_kernel_t<isa>> ker_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_lrn_bwd_t : public primitive_t {
+    struct pd_t : public cpu_lrn_bwd_pd_t {
+        using cpu_lrn_bwd_pd_t::cpu_lrn_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_lrn_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_lrn_conf_t conf_;
+    };
+
+    jit_uni_lrn_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // The backward pass is split into two kernels: the first one scales
+    // diff_dst by O^-beta and stores the terms to be reduced, the second one
+    // reduces them over the window.
+    std::unique_ptr<jit_uni_lrn_kernel_t<isa>> ker_scale_, ker_reduce_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,206 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/lrn/jit_uni_lrn_kernel.hpp"
+
+#define GET_OFF(field) offsetof(jit_lrn_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+jit_uni_lrn_kernel_t<isa>::jit_uni_lrn_kernel_t(
+        lrn_kernel_kind_t kind, float alpha, float k, float beta)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true)
+    , kind_(kind)
+    , alpha_(alpha)
+    , k_(k)
+    , beta_(beta) {
+    // O^-0.75 is computed with square roots only, any other power goes
+    // through exp(-beta * log(O)).
+    if (kind_ != lrn_kernel_kind_t::bwd_reduce && beta_ != 0.75f) {
+        log_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, true,
+                reg_log_injector_table, injector_mask, injector_tmp));
+        exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, true,
+                reg_exp_injector_table, injector_mask, injector_tmp));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_kernel_t<isa>::load_params() {
+#define PARAM_LOAD(reg, field) \
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(field), X_TMP_0); \
+    ldr(reg, ptr(X_DEFAULT_ADDR));
+
+    PARAM_LOAD(reg_ws, ws);
+    PARAM_LOAD(reg_src, src);
+    PARAM_LOAD(reg_diff_dst, diff_dst);
+    PARAM_LOAD(reg_dst, dst);
+    PARAM_LOAD(reg_tmp, tmp);
+    PARAM_LOAD(reg_len, len);
+    PARAM_LOAD(reg_cnt0, cnt0);
+    PARAM_LOAD(reg_stride0, stride0);
+    PARAM_LOAD(reg_cnt1, cnt1);
+    PARAM_LOAD(reg_stride1, stride1);
+#undef PARAM_LOAD
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_kernel_t<isa>::window_sum() {
+    Label row_loop, col_loop;
+
+    eor(vsum.d, vsum.d, vsum.d);
+    mov(reg_row, reg_ws);
+    mov(reg_row_cnt, reg_cnt0);
+    L(row_loop);
+    {
+        mov(reg_pos, reg_row);
+        mov(reg_col_cnt, reg_cnt1);
+        L(col_loop);
+        {
+            ld1w(vtmp.s, p_lanes / T_z, ptr(reg_pos));
+            if (kind_ == lrn_kernel_kind_t::bwd_reduce)
+                fadd(vsum.s, vsum.s, vtmp.s);
+            else
+                fmla(vsum.s, P_ALL_ONE / T_m, vtmp.s, vtmp.s);
+            add(reg_pos, reg_pos, reg_stride1);
+            subs(reg_col_cnt, reg_col_cnt, 1);
+            b(GT, col_loop);
+        }
+        add(reg_row, reg_row, reg_stride0);
+        subs(reg_row_cnt, reg_row_cnt, 1);
+        b(GT, row_loop);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_kernel_t<isa>::compute_negative_pow(const TReg &v) {
+    if (beta_ == 0.75f) {
+        // O^-0.75 = sqrt(1 / (sqrt(O) * O)), same as the reference
+        fsqrt(vtmp.s, P_ALL_ONE / T_m, v.s);
+        fmul(vtmp.s, vtmp.s, v.s);
+        mov(v.d, vone.d);
+        fdiv(v.s, P_ALL_ONE / T_m, vtmp.s);
+        fsqrt(v.s, P_ALL_ONE / T_m, v.s);
+    } else {
+        log_injector_->compute_vector(v.getIdx());
+        fmul(v.s, v.s, vneg_beta.s);
+        exp_injector_->compute_vector(v.getIdx());
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_kernel_t<isa>::generate() {
+    preamble();
+
+    if (simd_w_ != cpu_sveLen / sizeof(float))
+        set_preg(P_ALL_ONE.s, simd_w_, X_TMP_0, X_TMP_1);
+    if (log_injector_) log_injector_->load_table_addr();
+    if (exp_injector_) exp_injector_->load_table_addr();
+
+    load_params();
+
+    if (kind_ == lrn_kernel_kind_t::bwd_reduce) {
+        init_vmm(vcoef, X_TMP_0, 2.f * alpha_ * beta_);
+    } else {
+        init_vmm(valpha, X_TMP_0, alpha_);
+        init_vmm(vk, X_TMP_0, k_);
+        if (beta_ == 0.75f)
+            init_vmm(vone, X_TMP_0, 1.f);
+        else
+            init_vmm(vneg_beta, X_TMP_0, -beta_);
+    }
+
+    Label vec_loop, vec_loop_end;
+
+    mov_imm(reg_idx, 0);
+    L(vec_loop);
+    {
+        cmp(reg_idx, reg_len);
+        b(GE, vec_loop_end);
+
+        // The last iteration processes the tail with a partial predicate
+        whilelt(p_lanes.s, reg_idx, reg_len);
+        and_(p_lanes.b, P_ALL_ONE / T_z, p_lanes.b, p_lanes.b);
+
+        window_sum();
+        ld1w(vsrc.s, p_lanes / T_z, ptr(reg_src));
+
+        switch (kind_) {
+            case lrn_kernel_kind_t::fwd:
+                fmad(vsum.s, P_ALL_ONE / T_m, valpha.s, vk.s);
+                compute_negative_pow(vsum);
+                fmul(vsum.s, vsum.s, vsrc.s);
+                st1w(vsum.s, p_lanes, ptr(reg_dst));
+                break;
+            case lrn_kernel_kind_t::bwd_scale:
+                ld1w(vdiff_dst.s, p_lanes / T_z, ptr(reg_diff_dst));
+                fmad(vsum.s, P_ALL_ONE / T_m, valpha.s, vk.s);
+                mov(vpow.d, vsum.d);
+                compute_negative_pow(vpow);
+                fmul(vpow.s, vpow.s, vdiff_dst.s);
+                st1w(vpow.s, p_lanes, ptr(reg_dst));
+                fmul(vpow.s, vpow.s, vsrc.s);
+                fdiv(vpow.s, P_ALL_ONE / T_m, vsum.s);
+                st1w(vpow.s, p_lanes, ptr(reg_tmp));
+                break;
+            case lrn_kernel_kind_t::bwd_reduce:
+                ld1w(vdiff_dst.s, p_lanes / T_z, ptr(reg_diff_dst));
+                fmul(vsum.s, vsum.s, vsrc.s);
+                fmls(vdiff_dst.s, P_ALL_ONE / T_m, vsum.s, vcoef.s);
+                st1w(vdiff_dst.s, p_lanes, ptr(reg_dst));
+                break;
+            default: assert(!"unknown lrn kernel kind");
+        }
+
+        const int vlen = cpu_isa_traits<isa>::vlen;
+        add_imm(reg_ws, reg_ws, vlen, X_TMP_0);
+        add_imm(reg_src, reg_src, vlen, X_TMP_0);
+        add_imm(reg_dst, reg_dst, vlen, X_TMP_0);
+        if (kind_ != lrn_kernel_kind_t::fwd)
+            add_imm(reg_diff_dst, reg_diff_dst, vlen, X_TMP_0);
+        if (kind_ == lrn_kernel_kind_t::bwd_scale)
+            add_imm(reg_tmp, reg_tmp, vlen, X_TMP_0);
+        add_imm(reg_idx, reg_idx, simd_w_, X_TMP_0);
+        b(vec_loop);
+    }
+    L(vec_loop_end);
+
+    postamble();
+
+    if (log_injector_) log_injector_->prepare_table();
+    if (exp_injector_) exp_injector_->prepare_table();
+}
+
+template struct jit_uni_lrn_kernel_t<sve_512>;
+template struct jit_uni_lrn_kernel_t<sve_256>;
+template struct jit_uni_lrn_kernel_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
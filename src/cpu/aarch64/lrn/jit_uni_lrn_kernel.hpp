@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_LRN_JIT_UNI_LRN_KERNEL_HPP
+#define CPU_AARCH64_LRN_JIT_UNI_LRN_KERNEL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Every lane `i` of the kernel works on a window of cnt0 x cnt1 points which
+// starts at ws + i and is walked with stride0 and stride1 (both in bytes).
+// This covers across channels (window over rows of a channel-major buffer or
+// over a zero padded channel row) as well as within channel (window over a
+// spatial neighbourhood) normalization.
+struct jit_lrn_call_s {
+    const float *ws; // window origin for the first lane
+    const float *src;
+    const float *diff_dst; // scaled diff_dst for the reduce kernel
+    float *dst;
+    float *tmp;
+    size_t len;
+    size_t cnt0, stride0;
+    size_t cnt1, stride1;
+};
+
+enum class lrn_kernel_kind_t {
+    // dst = src * (k + alpha * sum(ws^2))^-beta
+    fwd,
+    // dst = diff_dst * O^-beta, tmp = dst * src / O,
+    // where O = k + alpha * sum(ws^2)
+    bwd_scale,
+    // dst = diff_dst - 2 * alpha * beta * src * sum(ws)
+    bwd_reduce,
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_lrn_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_lrn_kernel_t)
+
+    // alpha is expected to be already divided by the number of summands.
+    jit_uni_lrn_kernel_t(
+            lrn_kernel_kind_t kind, float alpha, float k, float beta);
+
+private:
+    using XReg = Xbyak_aarch64::XReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void generate() override;
+    void load_params();
+    void window_sum();
+    void compute_negative_pow(const TReg &v);
+
+    const lrn_kernel_kind_t kind_;
+    const float alpha_;
+    const float k_;
+    const float beta_;
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> log_injector_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    const XReg reg_param = abi_param1;
+    const XReg reg_ws = x1;
+    const XReg reg_src = x2;
+    const XReg reg_diff_dst = x3;
+    const XReg reg_dst = x4;
+    const XReg reg_tmp = x5;
+    const XReg reg_len = x6;
+    const XReg reg_cnt0 = x7;
+    const XReg reg_stride0 = x8;
+    const XReg reg_cnt1 = x10;
+    const XReg reg_stride1 = x11;
+    const XReg reg_idx = x12;
+    const XReg reg_row = x13;
+    const XReg reg_pos = x14;
+    const XReg reg_row_cnt = x15;
+    const XReg reg_col_cnt = x16;
+    const XReg reg_log_injector_table = x9;
+    const XReg reg_exp_injector_table = x17;
+
+    const PReg p_lanes = p2;
+    const PReg injector_mask = p1;
+    const PReg injector_tmp = p6;
+
+    const TReg vsum = TReg(0);
+    const TReg vtmp = TReg(1);
+    const TReg vsrc = TReg(2);
+    const TReg vpow = TReg(3);
+    const TReg vdiff_dst = TReg(4);
+    const TReg valpha = TReg(26);
+    const TReg vk = TReg(27);
+    const TReg vone = TReg(28);
+    const TReg vneg_beta = TReg(29);
+    const TReg vcoef = TReg(30);
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
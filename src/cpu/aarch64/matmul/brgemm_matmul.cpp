@@ -24,6 +24,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/platform.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_binary_injector.hpp"
@@ -154,12 +155,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_MATMUL(
             no_dynamic_strides_for_B_and_C, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
-    VDISPATCH_MATMUL(
-            attr()->has_default_values(primitive_attr_t::skip_mask_t::scales
-                            | primitive_attr_t::skip_mask_t::zero_points
-                            | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
-                    dst_dt),
+    auto skip_mask = primitive_attr_t::skip_mask_t::scales
+            | primitive_attr_t::skip_mask_t::zero_points
+            | primitive_attr_t::skip_mask_t::post_ops
+            | primitive_attr_t::skip_mask_t::sum_dt;
+    // f16 may be accumulated in f16, see brgemm_t::is_f16_acc
+    if (is_f16) skip_mask |= primitive_attr_t::skip_mask_t::accumulation_mode;
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
             VERBOSE_UNSUPPORTED_DT);
@@ -209,6 +211,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+        brgattr.hint_store_nt_D = bgmmc_.post_ops_applicable
+                && platform::use_nt_stores(memory_desc_wrapper(dst_md_).size());
 
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
 
@@ -233,6 +237,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     if ((mayiuse(sve_512) && is_B_transposed) || is_A_transposed)
         return status::unimplemented;
 
+    // there is no 128-bit transposed B copy kernel
+    if (isa == sve_128 && is_B_transposed) return status::unimplemented;
+
     return status::success;
 }
 
@@ -1483,6 +1490,7 @@ private:
 
 template struct brgemm_matmul_t<sve_512>;
 template struct brgemm_matmul_t<sve_256>;
+template struct brgemm_matmul_t<sve_128>;
 
 } // namespace matmul
 } // namespace aarch64
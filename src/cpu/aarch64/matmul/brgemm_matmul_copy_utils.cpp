@@ -502,8 +502,9 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
     jit_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
         , jit_generator()
-        , dt_in_(data_type::f32)
+        , dt_in_(conf->wei_dt)
         , typesize_in_(types::data_type_size(dt_in_))
+        , typesize_out_(typesize_in_)
         , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
                                              : conf_->N * typesize_in_)
         , tr_src_stride_(conf_->LDB * typesize_out_) {
@@ -523,9 +524,11 @@ private:
     enum { n_blk_step = 8, max_regs_available = 30 };
     const data_type_t dt_in_;
     const size_t typesize_in_;
-    const size_t typesize_out_ = sizeof(float);
+    // f16 weights are kept in f16 and converted by the brgemm kernel
+    const size_t typesize_out_;
     dim_t src_stride_, tr_src_stride_;
-    const bool is_sve_256 = !mayiuse(sve_512);
+    // the copy writes whole hardware vectors
+    const int simd_w_ = static_cast<int>(cpu_sveLen / sizeof(float));
 
     opmask_t kTail = p7;
     opmask_t kFFFF = p6;
@@ -550,7 +553,7 @@ private:
 void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
         int nrows, int ncolumns) {
 
-    int n_blk_step = is_sve_256 ? 8 : 16;
+    const int n_blk_step = simd_w_;
 
     auto get_zmm = [](int reg_idx) {
         assert(reg_idx >= 0 && reg_idx < max_regs_available);
@@ -561,7 +564,17 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
         auto src_zmm = get_zmm(blk);
         add_imm(X_DEFAULT_ADDR, reg_src, k * src_stride_ + n * typesize_in_,
                 X_TMP_0);
-        ld1w(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+        if (dt_in_ == data_type::f16)
+            ld1h(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+        else
+            ld1w(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+    };
+
+    auto store = [this](const ZReg &src_zmm) {
+        if (dt_in_ == data_type::f16)
+            st1h(src_zmm.s, kFFFF, ptr(X_DEFAULT_ADDR));
+        else
+            str(src_zmm, ptr(X_DEFAULT_ADDR));
     };
 
     const int columns_tail = ncolumns % n_blk_step;
@@ -577,7 +590,7 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
         const int zero_padding = ncolumns - n;
         if (zero_padding <= 0) {
             add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off, X_TMP_0);
-            str(zmm_zero, ptr(X_DEFAULT_ADDR));
+            store(zmm_zero);
             continue;
         }
 
@@ -586,7 +599,7 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
         load(blk_idx, k, n, curr_msk);
         add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off, X_TMP_0);
         const auto src_zmm0 = ZReg(blk_idx);
-        str(src_zmm0, ptr(X_DEFAULT_ADDR));
+        store(src_zmm0);
         iter++;
     }
 }
@@ -610,7 +623,7 @@ void jit_brgemm_matmul_copy_b_f32_t::compute_k_loop(int ncolumns) {
         L(K_end_label);
     };
 
-    int k_unroll = is_sve_256 ? 8 : 16;
+    const int k_unroll = simd_w_ >= 16 ? 16 : 8;
     compute_uni_k_loop(k_unroll);
     compute_uni_k_loop(1);
 }
@@ -1093,8 +1106,9 @@ status_t create_brgemm_matmul_copy_b(
     const bool is_f32 = everyone_is(data_type::f32, conf->src_dt, conf->wei_dt);
 
     const bool is_f16 = everyone_is(data_type::f16, conf->src_dt, conf->wei_dt);
-    assert(is_f32);
-    assert(!(is_bf16 || is_f16));
+    assert(is_f32 || is_f16);
+    assert(!is_bf16);
+    assert(IMPLICATION(is_f16, !is_B_transposed));
 
     if (is_B_transposed) {
         if (is_superset(conf->isa, sve_512))
@@ -1106,9 +1120,9 @@ status_t create_brgemm_matmul_copy_b(
                     new jit_brgemm_matmul_copy_b_transposed_t<sve_256>(conf)));
         }
     } else {
-        if (is_bf16 || is_f16 || conf->is_bf32) {
+        if (is_bf16 || conf->is_bf32) {
             assert(!"unreacable");
-        } else if (is_f32) {
+        } else if (is_f32 || is_f16) {
             CHECK(safe_ptr_assign(
                     copy_ker, new jit_brgemm_matmul_copy_b_f32_t(conf)));
         } else {
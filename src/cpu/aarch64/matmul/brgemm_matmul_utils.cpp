@@ -152,6 +152,9 @@ status_t check_datatype(const brgemm_matmul_conf_utils_t &bm_conf_utils) {
             && !bm_conf_utils.is_bf16() && !bm_conf_utils.is_f16()
             && !bm_conf_utils.is_int8())
         return status::success;
+    // f16 is computed by the f32 kernels, the inputs are converted on load
+    else if (bm_conf_utils.is_f16())
+        return status::success;
     else
         return status::unimplemented;
 }
@@ -251,6 +254,23 @@ status_t brgemm_matmul_conf_utils_t::update_and_check_B_tag(
     return set_or_check_B_tag(B_md, false);
 }
 
+bool brgemm_matmul_conf_utils_t::is_plain_with_padded_ld(
+        const memory_desc_t &A_md) const {
+    const memory_desc_wrapper A_d(A_md);
+    const int ndims = A_d.ndims();
+    if (ndims > 3 || !A_d.is_blocking_desc()
+            || A_d.has_runtime_dims_or_strides()
+            || A_d.blocking_desc().inner_nblks != 0)
+        return false;
+
+    const dims_t &strides = A_d.blocking_desc().strides;
+    const dim_t M = A_d.dims()[ndims - 2];
+    const dim_t K = A_d.dims()[ndims - 1];
+    const dim_t lda = strides[ndims - 2];
+    return strides[ndims - 1] == 1 && lda > K
+            && IMPLICATION(ndims == 3, strides[0] >= M * lda);
+}
+
 status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
         memory_desc_t &C_md, memory_desc_t &bias_md) const {
     if (A_any_layout) {
@@ -273,6 +293,16 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
                         transposed_tensor_layout_tag, acbd)
                 : memory_desc_matches_one_of_tag(
                         A_md, plain_tensor_layout_tag, acbd);
+
+        // Plain A with a padded leading dimension, e.g. a slice of a wider
+        // tensor, is consumed in place: LDA is taken from the strides, and
+        // the copy A routine reads rows with the same stride when A has to
+        // be copied anyway. This avoids a reorder to a dense layout.
+        if (bgmmc.src_tag == format_tag::undef
+                && is_plain_with_padded_ld(A_md)) {
+            bgmmc.src_tag = plain_tensor_layout_tag;
+            bgmmc.src_padded_ld = true;
+        }
     }
 
     if (C_any_layout) {
@@ -498,7 +528,8 @@ struct matmul_sve512_blocking_params_t {
 
         bgmmc.use_buffer_c = is_buffer_c_required(
                 bgmmc.acc_dt, bgmmc.dst_dt, bgmmc.with_sum);
-        bgmmc.LDA = (bgmmc.src_tag == acbd && !bgmmc.use_buffer_a
+        bgmmc.LDA = ((bgmmc.src_tag == acbd || bgmmc.src_padded_ld)
+                                && !bgmmc.use_buffer_a
                         ? bgmmc.A_strides[1] / bgmmc.a_dt_sz
                         : get_actual_lda(bgmmc.use_buffer_a, bgmmc.tr_a_dt_sz));
     }
@@ -718,7 +749,7 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
 
         best_blocking.update_configuration(bgmmc);
     } else {
-        assert(one_of(bm_conf_utils.get_isa(), sve_256));
+        assert(one_of(bm_conf_utils.get_isa(), sve_256, sve_128));
 
         const matmul_sve512_blocking_params_t::matmul_params_t matmul(
                 bgmmc.M, bgmmc.N, bgmmc.K, bgmmc.batch);
@@ -773,7 +804,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
     // happens during copy-buffer computations
-    if (bgmmc.is_bf32 || bm_conf_utils.is_f16()) { assert(!"unreachable"); }
+    if (bgmmc.is_bf32) { assert(!"unreachable"); }
 
     bgmmc.acc_dt = bm_conf_utils.is_int8() ? s32 : f32;
 
@@ -855,7 +886,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // required granularity for k dimension
     bgmmc.required_k_granularity = 1;
     VCONDCHECK_BG(bgmmc.required_k_granularity > 0, VERBOSE_BLOCKING_FAIL, "");
-    bgmmc.wei_k_blk = data_type_vnni_simd_elems<sve_512>(bgmmc.wei_dt);
+    // f16 weights are not in vnni format and use the f32 blocking
+    bgmmc.wei_k_blk = data_type_vnni_simd_elems<sve_512>(
+            bm_conf_utils.is_f16() ? f32 : bgmmc.wei_dt);
 
     VCHECK_BG(bm_conf_utils.set_or_check_tags(src_md, dst_md, bias_md),
             VERBOSE_UNSUPPORTED_TAG);
@@ -877,12 +910,19 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     const bool treat_transposed_A_as_plain = transposed_A && bgmmc.M == 1;
     bgmmc.transposed_A = ((transposed_A && !treat_transposed_A_as_plain)
             || bgmmc.src_tag == adbc);
+    // There are no f16 copy routines for transposed A and B
+    VCONDCHECK_BG(IMPLICATION(bm_conf_utils.is_f16(),
+                          !bgmmc.transposed_A
+                                  && !bm_conf_utils.check_is_transposed(
+                                          bgmmc.wei_tag)),
+            VERBOSE_UNSUPPORTED_TAG);
     // For batched problems with plain A and C and fully broadcasted across B
     // we can merge all the batch dimensions into M if broadcast strategies
     // set is limited for binary post-ops
     const bool plain_A_layout = bm_conf_utils.check_is_plain(bgmmc.src_tag)
             || treat_transposed_A_as_plain;
     const bool merge_batch_dims_into_M = bgmmc.batch > 1
+            && !bgmmc.src_padded_ld
             && bgmmc.bcast_B_desc.bcast_across_all_batch_dims
             && bm_conf_utils.check_is_plain(bgmmc.dst_tag) && plain_A_layout
             && post_ops_ok(
@@ -1031,6 +1071,7 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.A_ptr_shift_b = 0;
     bgmmc.copy_A_src_stride
             = bgmmc.a_dt_sz * (bgmmc.transposed_A ? bgmmc.M : bgmmc.K);
+    if (bgmmc.src_padded_ld) bgmmc.copy_A_src_stride = bgmmc.A_strides[1];
     if (bgmmc.src_tag == acbd || bgmmc.src_tag == adbc) {
         const dim_t factor = bgmmc.src_dt == f32 ? 2 : 1;
         const dim_t src_stride = bgmmc.src_tag == acbd ? bgmmc.A_strides[1]
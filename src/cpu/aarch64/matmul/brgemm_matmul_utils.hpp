@@ -185,6 +185,8 @@ struct brgemm_matmul_conf_t {
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+    // A is plain with a leading dimension stride larger than K
+    bool src_padded_ld = false;
     inline bool lda_big_pow2() const {
         const dim_t big_K_threshold = 4096;
         return !transposed_A && math::is_pow2(K) && K >= big_K_threshold;
@@ -278,6 +280,7 @@ struct brgemm_matmul_conf_utils_t {
     status_t set_or_check_B_tag(
             memory_desc_t &B_md, bool init_n_tag = true) const;
     status_t update_and_check_B_tag(memory_desc_t &B_md, int n_blk_size) const;
+    bool is_plain_with_padded_ld(const memory_desc_t &A_md) const;
     status_t set_or_check_tags(memory_desc_t &A_md, memory_desc_t &C_md,
             memory_desc_t &bias_md) const;
     status_t set_B_flags(memory_desc_t &B_md) const;
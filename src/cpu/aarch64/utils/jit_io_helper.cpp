@@ -532,8 +532,6 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
         const bool tail) {
     assert(IMPLICATION(tail, tail_conf_.has_value())
             && "Config for tail processing is not set.");
-    assert(!(tail && io_conf_.nt_stores_enabled_)
-            && "Usage of non-temporal stores with tail leads to a general-protection exception.");
 
     Xbyak_aarch64::PReg mask
             = tail ? tail_conf_->tail_opmask_ : host_->P_ALL_ONE;
@@ -570,8 +568,10 @@ template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_f32(const Vmm &src_vmm,
         const Xbyak_aarch64::XReg &dst_addr, const int offt, const bool tail,
         const Xbyak_aarch64::PReg &mask) {
-    if (io_conf_.nt_stores_enabled_) {
-        host_->stnt1d(Xbyak_aarch64::ZRegD(src_vmm.getIdx()), mask,
+    // Predicated SVE non-temporal stores are safe for the tail as well,
+    // ASIMD has no single register non-temporal store and uses regular ones.
+    if (io_conf_.nt_stores_enabled_ && is_superset(isa_, sve_128)) {
+        host_->stnt1w(Xbyak_aarch64::ZRegS(src_vmm.getIdx()), mask,
                 Xbyak_aarch64::ptr(dst_addr));
     } else if (!is_superset(isa_, sve_128) && tail) {
         // ASIMD 128-bit
@@ -634,21 +634,14 @@ void jit_io_helper_t<Vmm>::store_i8(const Vmm &src_vmm,
         const Xbyak_aarch64::XReg &dst_addr, const int offt,
         const Xbyak_aarch64::PReg &mask) {
     using namespace std::placeholders;
-    static constexpr bool is_zmm
-            = std::is_same<Vmm, Xbyak_aarch64::ZReg>::value;
 
+    // The narrowing byte stores have no non-temporal form, so regular stores
+    // are used regardless of io_conf_.nt_stores_enabled_.
     auto store_i8_fn = data_type_ == data_type::s8
             ? std::bind(&jit_io_helper_t::store_i8_sdb, this, _1, _2, _3)
             : std::bind(&jit_io_helper_t::store_i8_udb, this, _1, _2, _3);
 
-    if (io_conf_.nt_stores_enabled_ && is_zmm) {
-        host_->not_(
-                host_->P_TMP.b, mask / Xbyak_aarch64::T_z, host_->P_NOT_128.b);
-        host_->stnt1d(Xbyak_aarch64::ZRegD(src_vmm.getIdx()), mask,
-                Xbyak_aarch64::ptr(dst_addr));
-    } else {
-        store_i8_fn(dst_addr, src_vmm, mask);
-    }
+    store_i8_fn(dst_addr, src_vmm, mask);
 }
 
 template <typename Vmm>
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "common/c_types_map.hpp"
+#include "common/huge_pages.hpp"
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
 #include "common/stream.hpp"
@@ -33,8 +34,13 @@ namespace cpu {
 
 class cpu_memory_storage_t : public memory_storage_t {
 public:
-    cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
+    // Buffers allocated by the storage are backed by pages according to
+    // `huge_pages_mode`. Only library internal buffers should use huge pages.
+    cpu_memory_storage_t(engine_t *engine,
+            huge_pages_mode_t huge_pages_mode = huge_pages_mode::none)
+        : memory_storage_t(engine)
+        , huge_pages_mode_(huge_pages_mode)
+        , data_(nullptr, release) {}
     ~cpu_memory_storage_t() override = default;
 
     status_t get_data_handle(void **handle) const override {
@@ -87,6 +93,13 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
+        if (huge_pages_mode_ != huge_pages_mode::none) {
+            void *ptr = malloc_huge_pages(
+                    size, platform::get_cache_line_size(), huge_pages_mode_);
+            if (!ptr) return status::out_of_memory;
+            data_ = decltype(data_)(ptr, destroy_huge_pages);
+            return status::success;
+        }
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
@@ -94,12 +107,14 @@ protected:
     }
 
 private:
+    huge_pages_mode_t huge_pages_mode_;
     std::unique_ptr<void, void (*)(void *)> data_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
     static void destroy(void *ptr) { free(ptr); }
+    static void destroy_huge_pages(void *ptr) { free_huge_pages(ptr); }
 };
 
 } // namespace cpu
@@ -63,8 +63,18 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx2, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<sse41, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_512, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_512, f16>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_512, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_256, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_256, f16>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_256, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_128, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_128, f16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve_128, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<asimd, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<asimd, f16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<asimd, f32>)
             CPU_INSTANCE_AARCH64_ACL(acl_pooling_fwd_t)
             CPU_INSTANCE_RV64GCV(riscv_nchw_pooling_fwd_t<f32>)
             CPU_INSTANCE(nchw_pooling_fwd_t<bf16>)
@@ -87,6 +97,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<avx2>)
             CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<sse41>)
             CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_128>)
             CPU_INSTANCE(ref_pooling_fwd_t<s32>)
             CPU_INSTANCE(ref_pooling_fwd_t<s8, s32>)
             CPU_INSTANCE(ref_pooling_fwd_t<u8, s32>)
@@ -99,8 +111,18 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx2, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<sse41, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_512, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_512, f16>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_512, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_256, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_256, f16>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_256, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_128, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_128, f16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve_128, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<asimd, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<asimd, f16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<asimd, f32>)
             CPU_INSTANCE(nchw_pooling_bwd_t<bf16>)
             CPU_INSTANCE(nchw_pooling_bwd_t<f32>)
             CPU_INSTANCE(nchw_pooling_bwd_t<f16>)
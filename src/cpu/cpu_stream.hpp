@@ -27,6 +27,12 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/platform.hpp"
+
+#if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
+#include "cpu/aarch64/acl_thread.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -45,17 +51,36 @@ struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
         : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+#endif
 
     void before_exec_hook() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
         if (rc == status::success) threadpool_utils::activate_threadpool(tp);
+#endif
+        const bool affinity_changed
+                = affinity_utils::activate_cpu_affinity(cpu_affinity());
+#if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
+        if (affinity_changed)
+            aarch64::acl_thread_utils::acl_update_thread_affinity();
+#else
+        MAYBE_UNUSED(affinity_changed);
+#endif
     }
 
     void after_exec_hook() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         threadpool_utils::deactivate_threadpool();
-    }
 #endif
+        const bool affinity_changed = affinity_utils::deactivate_cpu_affinity();
+#if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
+        if (affinity_changed)
+            aarch64::acl_thread_utils::acl_update_thread_affinity();
+#else
+        MAYBE_UNUSED(affinity_changed);
+#endif
+    }
 };
 
 } // namespace cpu
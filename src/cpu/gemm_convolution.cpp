@@ -139,19 +139,35 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const exec_ctx_t &ctx,
             const dim_t K = jcp.ks * jcp.ic;
             const dim_t N = h_step * w_step;
             const dim_t LDA = M * jcp.ngroups;
-            const dim_t LDB = jcp.im2col_sz ? N : K * jcp.ngroups;
+            dim_t LDB = jcp.im2col_sz ? N : K * jcp.ngroups;
             const dim_t LDC = M * jcp.ngroups;
             const char *BT = jcp.im2col_sz ? "T" : "N";
             const data_t onef = 1.f;
             const float beta = this->beta_;
             const data_t *__restrict src_od
                     = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
+            if (jcp.no_copy_1xk) {
+                // Columns of the output row start every stride_w pixels.
+                src_od = src + (oh * jcp.stride_h * jcp.iw + ow * jcp.stride_w)
+                                * jcp.ic;
+                LDB = jcp.stride_w * jcp.ic;
+            }
             status_t st = extended_sgemm("N", BT, &M, &N, &K, &onef, wei, &LDA,
                     jcp.im2col_sz ? col : (data_t *)src_od, &LDB, &beta, dst,
                     &LDC);
             if (st != status::success) return st;
 
-            if (jcp.with_bias || jcp.with_eltwise || jcp.with_binary) {
+            if (pp_kernel_) {
+                const data_t *__restrict bia_arr
+                        = bia_base ? bia_base + g * jcp.oc : nullptr;
+                parallel(0, [&](int ithr, int nthr) {
+                    dim_t start, end;
+                    balance211(N * jcp.oc, nthr, ithr, start, end);
+                    (*pp_kernel_)(dst, dst, (const char *)bia_arr, nullptr,
+                            1.f, start, 0, 0, end, 0, dst_os_stride, nullptr,
+                            nullptr, nullptr, 0, ctx, *pd()->dst_md());
+                });
+            } else if (jcp.with_bias || jcp.with_eltwise || jcp.with_binary) {
                 parallel(0, [&](int ithr, int nthr) {
                     dim_t start, end;
                     balance211(N * jcp.oc, nthr, ithr, start, end);
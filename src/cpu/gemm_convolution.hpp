@@ -26,6 +26,7 @@
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/gemm/gemm.hpp"
 #include "cpu/gemm_convolution_utils.hpp"
+#include "cpu/gemm_inner_product_utils.hpp"
 #include "cpu/primitive_attr_postops.hpp"
 
 namespace dnnl {
@@ -112,6 +113,23 @@ struct gemm_convolution_fwd_t : public primitive_t {
             CHECK(safe_ptr_assign(post_ops_, new ref_post_ops_t(jcp.post_ops)));
             CHECK(post_ops_->init(pd()->dst_md()));
         }
+
+        // Bias and eltwise post-ops of the nspc path are fused into a single
+        // JIT pass over the gemm output when the target supports it. The sum
+        // post-op is already applied by the gemm through beta.
+        if (jcp.is_nspc && !jcp.with_binary
+                && (jcp.with_bias || jcp.with_eltwise)) {
+            using namespace inner_product_utils;
+            pp_kernel_.reset(pp_kernel_t::create_jit(jcp.oc, jcp.os,
+                    jcp.ngroups * jcp.oc, pd()->attr(),
+                    jcp.with_bias ? data_type::f32 : data_type::undef,
+                    data_type::f32, pd()->dst_md(), /* skip_sum = */ true));
+            // The output is split between threads, the kernel has to support
+            // arbitrary ranges.
+            if (pp_kernel_ && pp_kernel_->sequential_kernel())
+                pp_kernel_.reset();
+            if (pp_kernel_) CHECK(pp_kernel_->create_kernel());
+        }
         return status::success;
     }
 
@@ -134,6 +152,7 @@ private:
     data_t beta_;
 
     std::unique_ptr<ref_post_ops_t> post_ops_;
+    std::unique_ptr<inner_product_utils::pp_kernel_t> pp_kernel_;
 };
 
 struct gemm_convolution_bwd_data_t : public primitive_t {
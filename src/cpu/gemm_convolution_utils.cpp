@@ -1420,9 +1420,25 @@ status_t init_conf(conv_gemm_conf_t &jcp,
         if (jcp.is_nspc && is_fwd) {
             const size_t wei_size
                     = static_cast<size_t>(jcp.oc) * jcp.ic * jcp.kh * jcp.kw;
+            // A 1xK kernel without padding along width reads kw consecutive
+            // pixels of a row, which in nspc layout is exactly a column of
+            // the im2col matrix. The gemm then reads src in place row by row
+            // and no im2col buffer is needed.
+            jcp.no_copy_1xk = !is_bf16_conv && jcp.im2col_sz && !is_3d
+                    && jcp.ngroups == 1 && jcp.kh == 1 && jcp.dilate_w == 0
+                    && jcp.t_pad == 0 && jcp.l_pad == 0
+                    && (jcp.oh - 1) * jcp.stride_h < jcp.ih
+                    && (jcp.ow - 1) * jcp.stride_w + jcp.kw <= jcp.iw;
+            if (jcp.no_copy_1xk) {
+                jcp.im2col_sz = 0;
+                jcp.oh_block = 1;
+            }
+
+            // The im2col tiles of dilated convolutions are built by the
+            // generic path of im2col_dt().
             bool is_blocking_applicable = true && is_fwd && jcp.im2col_sz
-                    && !is_3d && jcp.dilate_h == 0 && jcp.dilate_w == 0
-                    && !is_depthwise && wei_size < static_cast<size_t>(L2) / 2;
+                    && !is_3d && !is_depthwise
+                    && wei_size < static_cast<size_t>(L2) / 2;
             // Logic for blocking for f32_nspc gemm convolution follows that of
             // int8_nspc gemm convolution. Currently, not optimized for f32
             // data type.
@@ -1543,6 +1559,31 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                                                 / max_threads
                                         < gemm_thrld);
             }
+            // Without the blocking above the im2col buffer covers the whole
+            // image. Split it into spatial tiles that fit the L2 of the
+            // threads working on a tile, so im2col and gemm are interleaved
+            // on cache-resident data and the scratchpad does not grow with
+            // the image size.
+            if (!is_blocking_applicable && jcp.im2col_sz && !is_3d) {
+                const size_t nthr_tile
+                        = jcp.outer_threading ? 1 : (size_t)max_threads;
+                const size_t tile_size = static_cast<size_t>(L2) * nthr_tile;
+                const size_t col_px_size = (size_t)jcp.ic * jcp.ks;
+                const size_t col_row_size = col_px_size * jcp.ow;
+                if (col_row_size * jcp.oh > tile_size) {
+                    jcp.oh_block = saturate(dim_t(1), jcp.oh,
+                            static_cast<dim_t>(tile_size / col_row_size));
+                    jcp.ow_block = jcp.ow;
+                    if (col_row_size > tile_size)
+                        jcp.ow_block = saturate(dim_t(simd_w), jcp.ow,
+                                rnd_dn(static_cast<dim_t>(
+                                               tile_size / col_px_size),
+                                        dim_t(simd_w)));
+                    jcp.im2col_sz = (ptrdiff_t)col_px_size * jcp.oh_block
+                            * jcp.ow_block;
+                }
+            }
+
             jcp.nthr = jcp.outer_threading ? max_threads : 1;
             const size_t gemm_col_datatype_size
                     = is_bf16_conv ? sizeof(bfloat16_t) : sizeof(float);
@@ -58,6 +58,9 @@ struct conv_gemm_conf_t {
     dim_t ow_block;
     dim_t os_block, os_nb_block;
     bool outer_threading;
+    // f32 nspc forward only: the gemm reads the columns of a 1xK kernel
+    // directly from src, one output row at a time.
+    bool no_copy_1xk;
     conv_gemm_loop_order_t loop_order;
     int nthr_oc;
 
@@ -26,6 +26,8 @@
 #if DNNL_X64
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_gemm_inner_product_utils.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_gemm_inner_product_utils.hpp"
 #endif
 
 #include "cpu/gemm_inner_product_utils.hpp"
@@ -196,14 +198,26 @@ pp_kernel_t::pp_kernel_t(size_t OC, size_t MB, dim_t dst_mb_stride,
         do_dst_zero_points_ = true;
 }
 
+pp_kernel_t *pp_kernel_t::create_jit(size_t OC, size_t MB,
+        dim_t dst_mb_stride, const primitive_attr_t *attr, data_type_t bias_dt,
+        data_type_t acc_dt, const memory_desc_t *dst_md, bool skip_sum) {
+#if DNNL_X64
+    return x64::inner_product_utils::jit_pp_kernel_create(
+            OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md, skip_sum);
+#elif DNNL_AARCH64
+    return aarch64::inner_product_utils::jit_pp_kernel_create(
+            OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md, skip_sum);
+#else
+    return nullptr;
+#endif
+}
+
 pp_kernel_t *pp_kernel_t::create(size_t OC, size_t MB, dim_t dst_mb_stride,
         const primitive_attr_t *attr, data_type_t bias_dt, data_type_t acc_dt,
         const memory_desc_t *dst_md, bool skip_sum) {
-#if DNNL_X64
-    auto *res = x64::inner_product_utils::jit_pp_kernel_create(
+    auto *res = create_jit(
             OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md, skip_sum);
     if (res) return res;
-#endif
 
     return new ref_pp_kernel_t(
             OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md, skip_sum);
@@ -33,6 +33,10 @@ struct pp_kernel_t {
     static pp_kernel_t *create(size_t OC, size_t MB, dim_t dst_mb_stride,
             const primitive_attr_t *attr, data_type_t bias_dt,
             data_type_t acc_dt, const memory_desc_t *dst_md, bool skip_sum);
+    // Returns nullptr if no JIT kernel supports the configuration.
+    static pp_kernel_t *create_jit(size_t OC, size_t MB, dim_t dst_mb_stride,
+            const primitive_attr_t *attr, data_type_t bias_dt,
+            data_type_t acc_dt, const memory_desc_t *dst_md, bool skip_sum);
     static pp_kernel_t *create(
             const cpu_inner_product_fwd_pd_t *pd, bool skip_sum) {
         return create(pd->OC(), pd->MB(), pd->OC(), pd->attr(),
@@ -21,6 +21,7 @@
 #include "cpu/matmul/gemm_bf16_matmul.hpp"
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/grouped_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
@@ -58,6 +59,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_lowp_matmul_t)
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_256>)
+        CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_128>)
         CPU_INSTANCE_AARCH64(jit_int8_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx10_2_512_amx_2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
@@ -81,12 +83,18 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         /* eol */
         nullptr,
 });
+
+constexpr impl_list_item_t grouped_impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE(grouped_matmul_t)
+        /* eol */
+        nullptr,
+});
 // clang-format on
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
-    return impl_list;
+    const bool is_grouped = desc->group_offsets_desc.ndims != 0;
+    return is_grouped ? grouped_impl_list : impl_list;
 }
 
 } // namespace cpu
@@ -0,0 +1,424 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+namespace {
+
+// Makes the nested primitive see a single thread at creation time: the task
+// matmul runs inside of the parallel region over the tasks, so it must take
+// the whole task and book the scratchpad for one thread only.
+struct single_thread_scope_t {
+    single_thread_scope_t() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        saved_nthr_ = omp_get_max_threads();
+        omp_set_num_threads(1);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        int &max_concurrency
+                = threadpool_utils::get_threadlocal_max_concurrency();
+        saved_nthr_ = max_concurrency;
+        max_concurrency = 1;
+#endif
+    }
+
+    ~single_thread_scope_t() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(saved_nthr_);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        threadpool_utils::get_threadlocal_max_concurrency() = saved_nthr_;
+#endif
+    }
+
+    // TBB doesn't provide a way to limit the concurrency of the calling
+    // thread, the groups are computed one by one there.
+    static bool is_supported() {
+        return DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_TBB;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(single_thread_scope_t);
+
+private:
+    int saved_nthr_ = 1;
+};
+
+bool is_brgemm_impl(const std::shared_ptr<primitive_desc_t> &pd) {
+    return std::string(pd->name()).find("brg") != std::string::npos;
+}
+
+// Returns the number of bytes between the quantization parameters of two
+// consecutive groups or 0 if the parameters are shared by the groups.
+dim_t quant_group_stride(const quant_entry_t &e, dim_t K, dim_t N) {
+    const int mask = e.get_mask();
+    if (!(mask & (1 << 0))) return 0;
+
+    dim_t count = 1;
+    if (mask & (1 << 1)) count *= K / e.get_group(0);
+    if (mask & (1 << 2)) count *= N / e.get_group(1);
+    return count * types::data_type_bits(e.get_data_type()) / 8;
+}
+
+// Drops the group dimension from the mask of the weights quantization
+// parameters.
+status_t init_nested_quant_entry(quant_entry_t &nested, const quant_entry_t &e) {
+    const int mask = e.get_mask() >> 1;
+    if (e.has_default_groups()) return nested.set(mask, e.get_data_type());
+
+    const dims_t group_dims = {e.get_group(0), e.get_group(1)};
+    return nested.set(mask, e.get_data_type(), 2, group_dims);
+}
+
+} // namespace
+
+status_t grouped_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md(0)->data_type;
+    const auto wei_dt = weights_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_MATMUL(with_groups(), VERBOSE_BAD_PARAM, "group_offsets");
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(
+            utils::one_of(src_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(utils::one_of(wei_dt, src_dt, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(utils::one_of(dst_dt, f32, src_dt), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::scales_data_type
+                                     | smask_t::scales_groups
+                                     | smask_t::zero_points_data_type
+                                     | smask_t::zero_points_groups
+                                     | smask_t::post_ops
+                                     | smask_t::fpmath_mode,
+                             dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(attr()->post_ops_.has_default_values(
+                             {primitive_kind::eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(attr()->scales_.has_default_values({DNNL_ARG_WEIGHTS})
+                    && attr_scales_ok({DNNL_ARG_WEIGHTS}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            attr()->zero_points_.has_default_values({DNNL_ARG_WEIGHTS}),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    // Rows of a group are addressed by a plain offset in src and dst, the
+    // groups of the weights are addressed by the outermost stride.
+    const memory_desc_wrapper src_d(src_md(0));
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md(0));
+    for (const auto *mdw : {&src_d, &wei_d, &dst_d}) {
+        VDISPATCH_MATMUL(mdw->is_plain() && !mdw->has_runtime_strides()
+                        && mdw->offset0() == 0,
+                VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "");
+    }
+    VDISPATCH_MATMUL(src_d.blocking_desc().strides[1] == 1,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_MATMUL(dst_d.blocking_desc().strides[1] == 1,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+    const dim_t wei_bits = types::data_type_bits(wei_dt);
+    const dim_t wei_group_stride_bits
+            = wei_d.blocking_desc().strides[0] * wei_bits;
+    VDISPATCH_MATMUL(wei_group_stride_bits % 8 == 0,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "weights");
+    wei_group_stride_ = wei_group_stride_bits / 8;
+
+    const auto &sc = attr()->scales_;
+    if (!sc.has_default_values(DNNL_ARG_WEIGHTS))
+        wei_scales_group_stride_
+                = quant_group_stride(sc.get(DNNL_ARG_WEIGHTS), K(), N());
+    const auto &zp = attr()->zero_points_;
+    if (!zp.has_default_values(DNNL_ARG_WEIGHTS))
+        wei_zero_points_group_stride_
+                = quant_group_stride(zp.get(DNNL_ARG_WEIGHTS), K(), N());
+
+    primitive_attr_t nested_attr(*attr());
+    VDISPATCH_MATMUL_SC(
+            init_nested_attr(nested_attr), VERBOSE_UNSUPPORTED_ATTR);
+
+    nthr_ = dnnl_get_max_threads();
+    m_blk_ = 32;
+    VDISPATCH_MATMUL_SC(create_nested_pd(engine, nested_attr, full_pd_, false),
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "matmul");
+    if (nthr_ > 1 && single_thread_scope_t::is_supported()) {
+        single_thread_scope_t scope;
+        // Falling back to the groups one by one is always possible.
+        if (create_nested_pd(engine, nested_attr, task_pd_, true)
+                != status::success)
+            task_pd_.reset();
+    }
+    name_ = std::string("grouped:") + full_pd_->name();
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t grouped_matmul_t::pd_t::init_nested_attr(
+        primitive_attr_t &nested_attr) {
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+        CHECK(nested_attr.scales_.set(arg, default_quant_entry()));
+        CHECK(nested_attr.zero_points_.set(arg, default_quant_entry()));
+    }
+
+    const auto &sc = attr()->scales_;
+    if (!sc.has_default_values(DNNL_ARG_WEIGHTS)) {
+        quant_entry_t e;
+        CHECK(init_nested_quant_entry(e, sc.get(DNNL_ARG_WEIGHTS)));
+        CHECK(nested_attr.scales_.set(DNNL_ARG_WEIGHTS, e));
+    }
+    const auto &zp = attr()->zero_points_;
+    if (!zp.has_default_values(DNNL_ARG_WEIGHTS)) {
+        quant_entry_t e;
+        CHECK(init_nested_quant_entry(e, zp.get(DNNL_ARG_WEIGHTS)));
+        CHECK(nested_attr.zero_points_.set(DNNL_ARG_WEIGHTS, e));
+    }
+
+    return nested_attr.set_scratchpad_mode(scratchpad_mode::user);
+}
+
+status_t grouped_matmul_t::pd_t::create_nested_pd(engine_t *engine,
+        const primitive_attr_t &nested_attr,
+        std::shared_ptr<primitive_desc_t> &nested_pd, bool brgemm_only) const {
+    const memory_desc_wrapper src_d(src_md(0));
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md(0));
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+
+    // The number of rows of a group is only known at execution time.
+    const dims_t src_dims = {DNNL_RUNTIME_DIM_VAL, K()};
+    const dims_t src_strides = {src_d.blocking_desc().strides[0], 1};
+    const dims_t wei_dims = {K(), N()};
+    const dims_t wei_2d_strides = {wei_strides[1], wei_strides[2]};
+    const dims_t dst_dims = {DNNL_RUNTIME_DIM_VAL, N()};
+    const dims_t dst_strides = {dst_d.blocking_desc().strides[0], 1};
+
+    memory_desc_t mm_src_md, mm_wei_md, mm_dst_md;
+    CHECK(memory_desc_init_by_strides(
+            mm_src_md, 2, src_dims, src_d.data_type(), src_strides));
+    CHECK(memory_desc_init_by_strides(
+            mm_wei_md, 2, wei_dims, wei_d.data_type(), wei_2d_strides));
+    CHECK(memory_desc_init_by_strides(
+            mm_dst_md, 2, dst_dims, dst_d.data_type(), dst_strides));
+
+    auto mm_desc = matmul_desc_t();
+    CHECK(matmul_desc_init(
+            &mm_desc, &mm_src_md, &mm_wei_md, nullptr, &mm_dst_md));
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&mm_desc, &nested_attr, nullptr);
+    while (it != it.end()) {
+        nested_pd = *(++it);
+        if (!nested_pd) return status::unimplemented;
+        if (!brgemm_only || is_brgemm_impl(nested_pd)) break;
+    }
+
+    return nested_pd ? status::success : status::unimplemented;
+}
+
+void grouped_matmul_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_nested, full_pd_->scratchpad_registry());
+    if (!task_pd_) return;
+
+    for (int ithr = 0; ithr < nthr_; ++ithr)
+        scratchpad.book(
+                key_nested_multiple + ithr, task_pd_->scratchpad_registry());
+}
+
+status_t grouped_matmul_t::init(engine_t *engine) {
+    CHECK(pd()->full_pd_->create_primitive(full_prim_, engine));
+    if (pd()->task_pd_) {
+        // The primitive cache key depends on the number of threads, so the
+        // task matmul must be created under the same limitation as its pd.
+        single_thread_scope_t scope;
+        CHECK(pd()->task_pd_->create_primitive(task_prim_, engine));
+    }
+    return status::success;
+}
+
+status_t grouped_matmul_t::execute_group(const exec_ctx_t &ctx,
+        const std::shared_ptr<primitive_t> &prim,
+        const memory_tracking::grantor_t *grantor, dim_t g, dim_t m_start,
+        dim_t m_len) const {
+    engine_t *engine = ctx.stream()->engine();
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    const dim_t lda = src_d.blocking_desc().strides[0];
+    const dim_t ldd = dst_d.blocking_desc().strides[0];
+
+    const dims_t src_dims = {m_len, pd()->K()};
+    const dims_t src_strides = {lda, 1};
+    const dims_t wei_dims = {pd()->K(), pd()->N()};
+    const dims_t wei_2d_strides = {wei_strides[1], wei_strides[2]};
+    const dims_t dst_dims = {m_len, pd()->N()};
+    const dims_t dst_strides = {ldd, 1};
+
+    memory_desc_t mm_src_md, mm_wei_md, mm_dst_md;
+    CHECK(memory_desc_init_by_strides(
+            mm_src_md, 2, src_dims, src_d.data_type(), src_strides));
+    CHECK(memory_desc_init_by_strides(
+            mm_wei_md, 2, wei_dims, wei_d.data_type(), wei_2d_strides));
+    CHECK(memory_desc_init_by_strides(
+            mm_dst_md, 2, dst_dims, dst_d.data_type(), dst_strides));
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    auto *src_ptr = const_cast<char *>(src)
+            + m_start * lda * src_d.data_type_size();
+    auto *wei_ptr = const_cast<char *>(wei) + g * pd()->wei_group_stride_;
+    auto *dst_ptr = dst + m_start * ldd * dst_d.data_type_size();
+
+    std::unique_ptr<memory_t, memory_deleter_t> src_mem, wei_mem, dst_mem;
+    CHECK(safe_ptr_assign(src_mem,
+            new memory_t(engine, &mm_src_md, use_runtime_ptr, src_ptr)));
+    CHECK(safe_ptr_assign(wei_mem,
+            new memory_t(engine, &mm_wei_md, use_runtime_ptr, wei_ptr)));
+    CHECK(safe_ptr_assign(dst_mem,
+            new memory_t(engine, &mm_dst_md, use_runtime_ptr, dst_ptr)));
+
+    exec_args_t args;
+    args[DNNL_ARG_SRC] = {src_mem.get(), true};
+    args[DNNL_ARG_WEIGHTS] = {wei_mem.get(), true};
+    args[DNNL_ARG_DST] = {dst_mem.get(), false};
+
+    // Per group scales and zero points are passed with the offset of the
+    // group, the shared ones are passed as is.
+    std::unique_ptr<memory_t, memory_deleter_t> qparams_mem[2];
+    const int qparams_args[2] = {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS,
+            DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS};
+    const dim_t qparams_group_strides[2] = {pd()->wei_scales_group_stride_,
+            pd()->wei_zero_points_group_stride_};
+    for (int i = 0; i < 2; ++i) {
+        const int arg = qparams_args[i];
+        const auto it = ctx.args().find(arg);
+        if (it == ctx.args().end()) continue;
+
+        if (qparams_group_strides[i] == 0) {
+            args[arg] = it->second;
+            continue;
+        }
+
+        const memory_t *user_mem = it->second.mem;
+        auto *ptr = static_cast<char *>(
+                            user_mem->memory_storage()->data_handle())
+                + g * qparams_group_strides[i];
+        CHECK(safe_ptr_assign(qparams_mem[i],
+                new memory_t(engine, user_mem->md(), use_runtime_ptr, ptr)));
+        args[arg] = {qparams_mem[i].get(), true};
+    }
+
+    exec_ctx_t nested_ctx(ctx, std::move(args));
+    nested_ctx.set_scratchpad_grantor(grantor);
+    return prim->execute(nested_ctx);
+}
+
+status_t grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto *offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    const dim_t G = pd()->G();
+    const dim_t M = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md(0)).dims()[0];
+
+    bool offsets_ok = offsets[0] >= 0 && offsets[G] <= M;
+    for (dim_t g = 0; g < G; ++g)
+        offsets_ok = offsets_ok && offsets[g] <= offsets[g + 1];
+    VCONDCHECK(primitive, exec, check, matmul, offsets_ok,
+            status::invalid_arguments, VERBOSE_BAD_PARAM, "group_offsets");
+
+    const dim_t total_rows = offsets[G] - offsets[0];
+    if (total_rows == 0 || pd()->K() == 0 || pd()->N() == 0)
+        return status::success;
+
+    const int nthr = nstl::min(pd()->nthr_, dnnl_get_current_num_threads());
+    const dim_t m_blk
+            = nstl::max(pd()->m_blk_, utils::div_up(total_rows, (dim_t)nthr));
+
+    // Every group contributes ceil(rows / m_blk) tasks.
+    std::vector<dim_t> task_offsets(G + 1, 0);
+    for (dim_t g = 0; g < G; ++g)
+        task_offsets[g + 1] = task_offsets[g]
+                + utils::div_up(offsets[g + 1] - offsets[g], m_blk);
+    const dim_t n_tasks = task_offsets[G];
+
+    // A nested matmul parallelized internally (e.g. over N) is a better fit
+    // when the tasks can't occupy at least half of the threads.
+    const bool use_tasks = task_prim_ && nthr > 1 && 2 * n_tasks >= nthr;
+    if (!use_tasks) {
+        nested_scratchpad_t ns(ctx, key_nested, full_prim_);
+        for (dim_t g = 0; g < G; ++g) {
+            const dim_t m_len = offsets[g + 1] - offsets[g];
+            if (m_len == 0) continue;
+            CHECK(execute_group(
+                    ctx, full_prim_, ns.grantor(), g, offsets[g], m_len));
+        }
+        return status::success;
+    }
+
+    std::vector<status_t> thr_status(nthr, status::success);
+    parallel(nthr, [&](const int ithr, const int nthr_) {
+        dim_t start {0}, end {0};
+        balance211(n_tasks, nthr_, ithr, start, end);
+        if (start == end) return;
+
+        nested_scratchpad_t ns(ctx, key_nested_multiple + ithr, task_prim_);
+        dim_t g = 0;
+        for (dim_t t = start; t < end; ++t) {
+            while (t >= task_offsets[g + 1])
+                ++g;
+            const dim_t m_start
+                    = offsets[g] + (t - task_offsets[g]) * m_blk;
+            const dim_t m_len
+                    = nstl::min(m_blk, (dim_t)offsets[g + 1] - m_start);
+            const status_t st = execute_group(
+                    ctx, task_prim_, ns.grantor(), g, m_start, m_len);
+            if (st != status::success) thr_status[ithr] = st;
+        }
+    });
+
+    for (const auto st : thr_status)
+        CHECK(st);
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GROUPED_MATMUL_HPP
+#define CPU_MATMUL_GROUPED_MATMUL_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Grouped (ragged) matmul:
+//   dst[off[g]:off[g + 1], :] = src[off[g]:off[g + 1], :] * wei[g, :, :]
+// The rows of every group are split into chunks and all the (group, chunk)
+// tasks are distributed over the threads in a single parallel region. Every
+// task is computed by a nested runtime-M matmul created for a single thread,
+// so the brgemm kernels and the weights decompression (int8/int4 weights with
+// grouped scales and zero points) of the regular matmul are reused as is.
+// When there are too few tasks to occupy the threads, the groups are computed
+// one by one by a nested matmul parallelized internally.
+struct grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(name_.c_str(), grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        dim_t G() const { return weights_md(0)->dims[0]; }
+
+        int nthr_ = 0;
+        // The rows of a group are split into chunks of at least `m_blk_`.
+        dim_t m_blk_ = 0;
+        // Nested matmul used when the groups are computed one by one.
+        std::shared_ptr<primitive_desc_t> full_pd_;
+        // Nested matmul used inside of the parallel region over the tasks,
+        // empty when the threading runtime doesn't allow creating it.
+        std::shared_ptr<primitive_desc_t> task_pd_;
+
+        // Byte offsets between the groups of the weights and of the weights
+        // scales and zero points, zero if the latter are shared by groups.
+        dim_t wei_group_stride_ = 0;
+        dim_t wei_scales_group_stride_ = 0;
+        dim_t wei_zero_points_group_stride_ = 0;
+
+    private:
+        std::string name_ = "grouped:any";
+
+        status_t init_nested_attr(primitive_attr_t &nested_attr);
+        status_t create_nested_pd(engine_t *engine,
+                const primitive_attr_t &nested_attr,
+                std::shared_ptr<primitive_desc_t> &nested_pd,
+                bool brgemm_only) const;
+        void init_scratchpad();
+    };
+
+    grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    status_t execute_group(const exec_ctx_t &ctx,
+            const std::shared_ptr<primitive_t> &prim,
+            const memory_tracking::grantor_t *grantor, dim_t g, dim_t m_start,
+            dim_t m_len) const;
+
+    std::shared_ptr<primitive_t> full_prim_;
+    std::shared_ptr<primitive_t> task_prim_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -16,13 +16,24 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdlib>
+#include <string>
 #include <thread>
 
+#if defined(__linux__)
+#include <fstream>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
 #include "cpu/platform.hpp"
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
-#include <algorithm>
-
 #if defined(_WIN32)
 #include <windows.h>
 #elif defined(__GLIBC__)
@@ -216,6 +227,234 @@ unsigned get_num_cores() {
 #endif
 }
 
+namespace {
+
+struct numa_topology_t {
+    std::vector<std::vector<int>> node_cpus;
+    std::vector<int> cpu_node;
+};
+
+#if defined(__linux__)
+// Parses a list in the sysfs format, e.g. "0-3,8,10-11".
+std::vector<int> parse_sysfs_list(const std::string &list) {
+    std::vector<int> ids;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        const std::string range = list.substr(pos, end - pos);
+        const size_t dash = range.find('-');
+        if (!range.empty()) {
+            const int first = (int)std::strtol(range.c_str(), nullptr, 10);
+            const int last = dash == std::string::npos
+                    ? first
+                    : (int)std::strtol(range.c_str() + dash + 1, nullptr, 10);
+            for (int id = first; id <= last; id++)
+                ids.push_back(id);
+        }
+        pos = end + 1;
+    }
+    return ids;
+}
+
+bool read_sysfs_list(const std::string &path, std::vector<int> &ids) {
+    std::ifstream file(path);
+    std::string list;
+    if (!file || !std::getline(file, list)) return false;
+    ids = parse_sysfs_list(list);
+    return true;
+}
+#endif
+
+numa_topology_t query_numa_topology() {
+    numa_topology_t topology;
+#if defined(__linux__)
+    const std::string node_path = "/sys/devices/system/node/";
+    std::vector<int> nodes;
+    if (read_sysfs_list(node_path + "online", nodes) && !nodes.empty()) {
+        for (int node : nodes) {
+            std::vector<int> cpus;
+            read_sysfs_list(node_path + "node" + std::to_string(node)
+                            + "/cpulist",
+                    cpus);
+            if (node >= (int)topology.node_cpus.size())
+                topology.node_cpus.resize(node + 1);
+            topology.node_cpus[node] = cpus;
+        }
+    }
+#endif
+    if (topology.node_cpus.empty()) {
+        std::vector<int> cpus(
+                std::max(std::thread::hardware_concurrency(), 1u));
+        for (size_t cpu = 0; cpu < cpus.size(); cpu++)
+            cpus[cpu] = (int)cpu;
+        topology.node_cpus.push_back(cpus);
+    }
+
+    for (size_t node = 0; node < topology.node_cpus.size(); node++) {
+        for (int cpu : topology.node_cpus[node]) {
+            if (cpu >= (int)topology.cpu_node.size())
+                topology.cpu_node.resize(cpu + 1, 0);
+            topology.cpu_node[cpu] = (int)node;
+        }
+    }
+    return topology;
+}
+
+const numa_topology_t &numa_topology() {
+    static const numa_topology_t topology = query_numa_topology();
+    return topology;
+}
+
+} // namespace
+
+int get_numa_node_count() {
+    return (int)numa_topology().node_cpus.size();
+}
+
+std::vector<int> get_numa_node_cpus(int node) {
+    const auto &node_cpus = numa_topology().node_cpus;
+    if (node < 0 || node >= (int)node_cpus.size()) return {};
+    return node_cpus[node];
+}
+
+int get_numa_node_of_cpu(int cpu) {
+    const auto &cpu_node = numa_topology().cpu_node;
+    if (cpu < 0 || cpu >= (int)cpu_node.size()) return 0;
+    return cpu_node[cpu];
+}
+
+int get_current_numa_node() {
+#if defined(__linux__) && defined(__GLIBC__)
+    return get_numa_node_of_cpu(::sched_getcpu());
+#else
+    return 0;
+#endif
+}
+
+bool is_numa_aware() {
+    static const bool numa_aware = getenv_int_user("CPU_NUMA_AWARE", 0) > 0
+            && get_numa_node_count() > 1;
+    return numa_aware;
+}
+
+namespace {
+
+#if defined(__linux__) && defined(SYS_move_pages)
+// Calls move_pages(2) for the pages of [ptr, ptr + size). When `node` is
+// negative the pages are not moved and `status` receives their current nodes.
+bool call_move_pages(
+        const void *ptr, size_t size, int node, std::vector<int> &status) {
+    if (!ptr || size == 0) return false;
+    const long sys_page_size = ::sysconf(_SC_PAGESIZE);
+    const uintptr_t page_size
+            = sys_page_size > 0 ? (uintptr_t)sys_page_size : PAGE_4K;
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(page_size - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(ptr) + size;
+    const size_t npages = (size_t)utils::div_up(end - start, page_size);
+
+    std::vector<void *> pages(npages);
+    for (size_t p = 0; p < npages; p++)
+        pages[p] = reinterpret_cast<void *>(start + p * page_size);
+    std::vector<int> nodes(npages, node);
+    status.assign(npages, -1);
+
+    // MPOL_MF_MOVE from <linux/mempolicy.h>: only move the pages which are
+    // not shared with other processes.
+    constexpr int mpol_mf_move = 1 << 1;
+    return ::syscall(SYS_move_pages, 0, npages, pages.data(),
+                   node < 0 ? nullptr : nodes.data(), status.data(),
+                   node < 0 ? 0 : mpol_mf_move)
+            == 0;
+}
+#endif
+
+} // namespace
+
+bool move_to_numa_node(const void *ptr, size_t size, int node) {
+#if defined(__linux__) && defined(SYS_move_pages)
+    if (node < 0 || node >= get_numa_node_count()) return false;
+    std::vector<int> status;
+    return call_move_pages(ptr, size, node, status);
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(node);
+    return false;
+#endif
+}
+
+int get_numa_node_of_address(const void *ptr) {
+#if defined(__linux__) && defined(SYS_move_pages)
+    std::vector<int> status;
+    if (!call_move_pages(ptr, 1, -1, status)) return -1;
+    return status[0];
+#else
+    UNUSED(ptr);
+    return -1;
+#endif
+}
+
+namespace {
+
+nt_stores_mode_t nt_stores_mode_from_env() {
+    const std::string mode = getenv_string_user("CPU_NT_STORES");
+    if (mode == "always") return nt_stores_mode_t::always;
+    if (mode == "never") return nt_stores_mode_t::never;
+    return nt_stores_mode_t::automatic;
+}
+
+set_once_before_first_get_setting_t<nt_stores_mode_t> &nt_stores_mode() {
+    static set_once_before_first_get_setting_t<nt_stores_mode_t> setting(
+            nt_stores_mode_from_env());
+    return setting;
+}
+
+// Returns the size of the last level data cache available to a core, as
+// reported by the hardware. Falls back to the guess of
+// get_per_core_cache_size() when the hierarchy is not reported.
+size_t get_llc_per_core_size() {
+#if DNNL_AARCH64
+    using namespace Xbyak_aarch64::util;
+    const auto &c = aarch64::cpu();
+    const unsigned last_level = c.getLastDataCacheLevel();
+    if (last_level >= 2 && last_level <= maxCacheLevel) {
+        size_t llc_per_core = 0;
+        for (unsigned l = 2; l <= last_level; l++) {
+            const auto level = static_cast<Arm64CacheLevel>(l);
+            const size_t size = c.getDataCacheSize(level);
+            const size_t ncores
+                    = std::max(c.getCoresSharingDataCache(level), 1U);
+            llc_per_core = std::max(llc_per_core, size / ncores);
+        }
+        if (llc_per_core > 0) return llc_per_core;
+    }
+#endif
+    return std::max(get_per_core_cache_size(2), get_per_core_cache_size(3));
+}
+
+} // namespace
+
+nt_stores_mode_t get_nt_stores_mode() {
+    return nt_stores_mode().get();
+}
+
+status_t set_nt_stores_mode(nt_stores_mode_t mode) {
+    return nt_stores_mode().set(mode) ? status::success
+                                      : status::runtime_error;
+}
+
+bool use_nt_stores(size_t dst_size) {
+    switch (get_nt_stores_mode()) {
+        case nt_stores_mode_t::always: return true;
+        case nt_stores_mode_t::never: return false;
+        default: break;
+    }
+    static const size_t llc_per_core = get_llc_per_core_size();
+    const size_t llc_size = llc_per_core * dnnl_get_max_threads();
+    return dst_size > llc_size / 2;
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 // The purpose of this function is to return the potential maximum number of
 // threads in user's threadpool. It is assumed that the number of threads in an
@@ -18,6 +18,8 @@
 #ifndef CPU_PLATFORM_HPP
 #define CPU_PLATFORM_HPP
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #include "common/c_types_map.hpp"
@@ -170,6 +172,38 @@ float DNNL_API s8s8_weights_scale_factor();
 
 unsigned DNNL_API get_per_core_cache_size(int level);
 unsigned DNNL_API get_num_cores();
+
+// NUMA topology. Nodes are identified by the OS node ids, nodes without CPUs
+// have an empty CPU list. When the topology can't be queried the system is
+// reported as a single node with all the CPUs.
+int DNNL_API get_numa_node_count();
+std::vector<int> DNNL_API get_numa_node_cpus(int node);
+int DNNL_API get_numa_node_of_cpu(int cpu);
+int DNNL_API get_current_numa_node();
+// Returns true if NUMA aware memory placement was requested with the
+// ONEDNN_CPU_NUMA_AWARE environment variable and the system has more than
+// one node.
+bool DNNL_API is_numa_aware();
+// Moves the pages of [ptr, ptr + size) to the given node. The pages must be
+// already mapped, e.g. written once. Returns false if the pages can't be moved
+// or if the OS doesn't support it.
+bool DNNL_API move_to_numa_node(const void *ptr, size_t size, int node);
+// Returns the node of the page containing ptr or -1 if the page isn't mapped
+// or the OS doesn't report it.
+int DNNL_API get_numa_node_of_address(const void *ptr);
+
+// Non-temporal (streaming) store policy for the output of memory bound
+// primitives. The default is taken from the ONEDNN_CPU_NT_STORES environment
+// variable (`auto`, `always` or `never`) and can be overridden only before
+// the first query.
+enum class nt_stores_mode_t { automatic, always, never };
+nt_stores_mode_t DNNL_API get_nt_stores_mode();
+status_t DNNL_API set_nt_stores_mode(nt_stores_mode_t mode);
+// Returns true if a primitive writing `dst_size` bytes should use
+// non-temporal stores. In the automatic mode this is the case when the output
+// exceeds half of the last level cache available to the library threads, as
+// reported by the hardware when the hierarchy is known.
+bool DNNL_API use_nt_stores(size_t dst_size);
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -407,6 +408,10 @@ struct rnn_conf_t {
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
+    // Cells on the same (layer + iter) diagonal are independent and may run
+    // concurrently, each one using its own slot of the cell scratchpads.
+    bool wavefront_exec = false;
+    int n_wavefront_slots = 1;
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
@@ -969,6 +974,21 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.use_projection_packed_gemm = false;
 #endif
 
+    /* Decide if independent cells of a multi-layer or bidirectional grid
+     * run concurrently along the (layer + iter) diagonals. This pays off
+     * only when a single cell gemm is too small to keep all threads busy.
+     * Merged, packed, matmul and brgemm cells are excluded as they either
+     * share buffers between cells or rely on their own threading layout. */
+    const int n_concurrent_cells
+            = rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter);
+    rnn.wavefront_exec = is_inference && rnn.is_fwd && !rnn.is_brgemm
+            && !rnn.use_matmul && !rnn.merge_gemm_layer
+            && !rnn.merge_gemm_iter && !rnn.use_layer_packed_gemm
+            && !rnn.use_iter_packed_gemm && !rnn.use_projection_packed_gemm
+            && rnn.mb <= 16 && n_concurrent_cells > 1
+            && dnnl_get_max_threads() > 1;
+    rnn.n_wavefront_slots = rnn.wavefront_exec ? n_concurrent_cells : 1;
+
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
     const auto set_pack_sizes
@@ -1165,10 +1185,10 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
-    rnn.scratch_ht_size
-            = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
+            * rnn.n_iter_scratch_gates * rnn.n_wavefront_slots
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+    rnn.scratch_ht_size = sizeof(typename T::ht_t) * rnn.n_wavefront_slots
+            * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
                     * rnn.scratch_diff_ht_nld * rnn.scratch_diff_ht_ld
                                                : (size_t)0;
@@ -1184,6 +1204,7 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
                                     * rnn.ws_states_layer_ld
                                     * sizeof(typename T::gemm_acc_t)
                             : 0);
+    rnn.scratch_cell_size *= rnn.n_wavefront_slots;
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
             * sizeof(typename T::gemm_acc_t);
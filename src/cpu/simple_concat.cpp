@@ -26,32 +26,150 @@ namespace cpu {
 
 using namespace memory_tracking::names;
 
-template <data_type_t data_type>
-status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
+status_t simple_concat_base_pd_t::init_simple(
+        engine_t *engine, data_type_t data_type) {
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONCAT(cpu_concat_pd_t::init() == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "concat");
+    VDISPATCH_CONCAT(
+            dst_d.ndims() <= 6, VERBOSE_BAD_NDIMS, "dst", dst_d.ndims());
+
+    for (size_t i = 0; i < src_mds_.size(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        const memory_desc_wrapper o_d(&src_image_mds_[i]);
+
+        const bool ignore_strides = true;
+
+        VDISPATCH_CONCAT(
+                utils::everyone_is(data_type, i_d.data_type(), o_d.data_type()),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_CONCAT(utils::everyone_is(format_kind::blocked,
+                                 i_d.format_kind(), o_d.format_kind()),
+                VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_CONCAT(types::blocking_desc_is_equal(
+                                 *i_d.md_, *o_d.md_, ignore_strides),
+                VERBOSE_BLOCKING_FAIL, "blocking descriptor mismatch");
+        VDISPATCH_CONCAT(types::blocking_desc_is_equal(
+                                 *i_d.md_, *dst_d.md_, ignore_strides),
+                VERBOSE_BLOCKING_FAIL, "blocking descriptor mismatch");
+        VDISPATCH_CONCAT(!i_d.is_additional_buffer(),
+                "memory format does not have additional buffer");
+    }
+
+    dst_d.compute_blocks(blocks_);
+    format_perm();
+
+    // start dim is the first dimension after which the concatenation
+    // would happen contiguously
+    const int start_dim = perm_[concat_dim()];
+
+    // check that contiguous part is indeed contiguous (i.e. dense)
+    VDISPATCH_CONCAT(!(nelems_to_concat(dst_d)
+                             != dst_d.padded_dims()[concat_dim()]
+                                     / blocks_[concat_dim()]
+                                     * dst_d.blocking_desc()
+                                               .strides[concat_dim()]),
+            VERBOSE_INCONSISTENT_NDIMS, "dst", "(padded_dims, concat_dim)");
+
+    // check that all inputs have the same strides for the
+    // contiguous part [concat_dim .. ndims] for the *major* dims.
+    // the block part is already checked above
+    for (size_t i = 0; i < src_mds_.size(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        for (int d = start_dim; d < dst_d.ndims(); ++d) {
+            VDISPATCH_CONCAT(!(dst_d.blocking_desc().strides[iperm_[d]]
+                                     != i_d.blocking_desc().strides[iperm_[d]]),
+                    "inputs have inconsistent strides for major dims");
+        }
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+dim_t simple_concat_base_pd_t::nelems_to_concat(
+        const memory_desc_wrapper &data_d) const {
+    const int ndims = data_d.ndims();
+
+    dim_t nelems = 1;
+    for (int i = perm_[concat_dim()]; i < ndims; i++)
+        nelems *= data_d.padded_dims()[iperm_[i]] / blocks_[iperm_[i]];
+    for (int i = 0; i < ndims; i++)
+        nelems *= blocks_[i];
+
+    return nelems;
+}
+
+void simple_concat_base_pd_t::format_perm() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+
+    dims_t blocks = {0};
+    dst_d.compute_blocks(blocks);
+
+    strides_t strides = {0};
+    utils::array_copy(strides, dst_d.blocking_desc().strides, ndims);
+
+    dims_t ou_blocks = {0};
+    utils::array_copy(ou_blocks, dst_d.padded_dims(), ndims);
+
+    for (int d = 0; d < ndims; d++) {
+        iperm_[d] = d;
+        ou_blocks[d] /= blocks[d];
+    }
+
+    utils::simultaneous_sort(strides, ou_blocks, iperm_, ndims,
+            [](stride_t a, stride_t b) { return b - a; });
+
+    for (int i = 0; i < ndims; i++)
+        perm_[iperm_[i]] = i;
+}
+
+void simple_concat_base_pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const char *>(key_concat_iptrs, n_inputs());
+    scratchpad.template book<char *>(key_concat_optrs, n_inputs());
+    scratchpad.template book<dim_t>(key_concat_nelems, n_inputs());
+    scratchpad.template book<strides_t>(key_concat_istrides, n_inputs());
+}
+
+void simple_concat_base_pd_t::copy_from(const simple_concat_base_pd_t &rhs) {
+    int ndims = rhs.dst_md_.ndims;
+    utils::array_copy(perm_, rhs.perm_, ndims);
+    utils::array_copy(iperm_, rhs.iperm_, ndims);
+    utils::array_copy(blocks_, rhs.blocks_, ndims);
+}
+
+status_t execute_simple_concat(const exec_ctx_t &ctx,
+        const simple_concat_base_pd_t *pd, const simple_concat_copy_f &copy) {
     auto scratchpad = ctx.get_scratchpad_grantor();
-    auto iptrs = scratchpad.template get<const data_t *>(key_concat_iptrs);
-    auto optrs = scratchpad.template get<data_t *>(key_concat_optrs);
+    auto iptrs = scratchpad.template get<const char *>(key_concat_iptrs);
+    auto optrs = scratchpad.template get<char *>(key_concat_optrs);
     auto nelems_to_copy = scratchpad.template get<dim_t>(key_concat_nelems);
     auto is = scratchpad.template get<strides_t>(key_concat_istrides);
 
-    const int num_arrs = pd()->n_inputs();
-    const int *perm = pd()->perm_, *iperm = pd()->iperm_;
-    const int concat_dim = pd()->concat_dim();
-    auto o_base_ptr = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    const int num_arrs = pd->n_inputs();
+    const int *perm = pd->perm_, *iperm = pd->iperm_;
+    const int concat_dim = pd->concat_dim();
+    auto o_base_ptr = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     if (o_base_ptr == nullptr) return status::success;
 
+    const memory_desc_wrapper o_d(pd->dst_md(0));
+    const size_t dt_size = o_d.data_type_size();
+
     for (int a = 0; a < num_arrs; ++a) {
-        const memory_desc_wrapper i_d(pd()->src_md(a));
-        const memory_desc_wrapper o_d(pd()->src_image_md(a));
-        const auto iptr = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
+        const memory_desc_wrapper i_d(pd->src_md(a));
+        const memory_desc_wrapper o_img_d(pd->src_image_md(a));
+        const auto iptr = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + a);
         if (iptr == nullptr) {
             iptrs[a] = nullptr;
             nelems_to_copy[a] = 0;
             continue;
         }
-        iptrs[a] = iptr + i_d.blk_off(0);
-        optrs[a] = o_base_ptr + o_d.blk_off(0);
-        nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        iptrs[a] = iptr + i_d.blk_off(0) * dt_size;
+        optrs[a] = o_base_ptr + o_img_d.blk_off(0) * dt_size;
+        nelems_to_copy[a] = pd->nelems_to_concat(i_d);
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
                 is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
@@ -60,8 +178,6 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         }
     }
 
-    const memory_desc_wrapper o_d(pd()->dst_md(0));
-
     strides_t os = {0};
     bool has_outer_loop = false;
     for (int i = 0; i < perm[concat_dim]; i++) {
@@ -79,13 +195,10 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
             for (int a = 0; a < num_arrs; ++a) {
                 dim_t start {0}, end {0};
                 balance211(nelems_to_copy[a], nthr, ithr, start, end);
+                if (start == end) continue;
 
-                const data_t *i = iptrs[a] + start;
-                data_t *o = optrs[a] + start;
-
-                PRAGMA_OMP_SIMD()
-                for (dim_t e = 0; e < end - start; ++e)
-                    o[e] = i[e];
+                copy(optrs[a] + start * dt_size, iptrs[a] + start * dt_size,
+                        (end - start) * dt_size);
             }
         });
 
@@ -95,15 +208,11 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     dims_t phys_dims;
     for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
         if (i < perm[concat_dim])
-            phys_dims[i]
-                    = o_d.padded_dims()[iperm[i]] / pd()->blocks_[iperm[i]];
+            phys_dims[i] = o_d.padded_dims()[iperm[i]] / pd->blocks_[iperm[i]];
         else
             phys_dims[i] = 1;
     }
 
-    const auto L1_size = platform::get_per_core_cache_size(1);
-    UNUSED(L1_size); // for Windows
-
     parallel_nd(phys_dims[0], phys_dims[1], phys_dims[2], phys_dims[3],
             phys_dims[4], num_arrs,
             [&](dim_t n0, dim_t n1, dim_t n2, dim_t n3, dim_t n4, dim_t a) {
@@ -117,14 +226,29 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
                         + is[a][3] * n3 + is[a][4] * n4;
                 size_t out_off = os[0] * n0 + os[1] * n1 + os[2] * n2
                         + os[3] * n3 + os[4] * n4;
-                const data_t *i = &iptrs[a][in_off];
-                data_t *o = &optrs[a][out_off];
+                copy(optrs[a] + out_off * dt_size, iptrs[a] + in_off * dt_size,
+                        nelems_to_copy[a] * dt_size);
+            });
+
+    return status::success;
+}
+
+template <data_type_t data_type>
+status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
+    const auto L1_size = platform::get_per_core_cache_size(1);
+    UNUSED(L1_size); // for Windows
+
+    return execute_simple_concat(ctx, pd(),
+            [&](char *dst, const char *src, size_t size) {
+                const dim_t nelems = size / sizeof(data_t);
+                const data_t *i = reinterpret_cast<const data_t *>(src);
+                data_t *o = reinterpret_cast<data_t *>(dst);
 
 #if defined(__GNUC__)
                 // Heuristic:
                 // memcpy works generally faster for data sizes not
                 // exceeding L1 cache.
-                if (nelems_to_copy[a] * sizeof(data_t) > L1_size) {
+                if (nelems * sizeof(data_t) > L1_size) {
                     // The code below performs data copying: o[e] = i[e]
                     // and uses a workaround to make GNU compilers optimize it
                     uint8_t *ptro = reinterpret_cast<uint8_t *>(o);
@@ -134,11 +258,10 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
                             - reinterpret_cast<uint64_t>(ptro)
                                     % sizeof(uint32_t);
                     const size_t main_part
-                            = (nelems_to_copy[a] - head_part / sizeof(data_t))
+                            = (nelems - head_part / sizeof(data_t))
                             * sizeof(data_t) / sizeof(uint32_t);
-                    const size_t tail_part
-                            = (nelems_to_copy[a] * sizeof(data_t)) - head_part
-                            - (main_part * sizeof(uint32_t));
+                    const size_t tail_part = (nelems * sizeof(data_t))
+                            - head_part - (main_part * sizeof(uint32_t));
                     for (size_t e = 0; e < head_part; ++e) {
                         *ptro = *ptri;
                         ++ptro;
@@ -157,15 +280,14 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
                         ++ptri;
                     }
                 } else {
-                    std::memcpy(o, i, nelems_to_copy[a] * sizeof(data_t));
+                    std::memcpy(o, i, nelems * sizeof(data_t));
                 }
 #else
                 PRAGMA_OMP_SIMD()
-                for (dim_t e = 0; e < nelems_to_copy[a]; ++e) o[e] = i[e];
+                for (dim_t e = 0; e < nelems; ++e)
+                    o[e] = i[e];
 #endif
             });
-
-    return status::success;
 }
 
 template struct simple_concat_t<data_type::f32>;
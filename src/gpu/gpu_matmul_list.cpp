@@ -52,12 +52,17 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         GPU_INSTANCE_GENERIC_SYCL(generic::sycl::ref_matmul_t)
         nullptr,
 });
+
+// Grouped matmul is not implemented on GPU.
+constexpr impl_list_item_t grouped_impl_list[] = {
+        nullptr,
+};
 // clang-format on
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
-    return impl_list;
+    const bool is_grouped = desc->group_offsets_desc.ndims != 0;
+    return is_grouped ? grouped_impl_list : impl_list;
 }
 
 } // namespace gpu
@@ -16,10 +16,17 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 
+#include <cstring>
+
+#include "common/huge_pages.hpp"
+
+#include "cpu/platform.hpp"
+
 #include "graph/interface/constant_tensor_cache.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
 #include "graph/backend/dnnl/dnnl_backend.hpp"
+#include "graph/backend/dnnl/passes/memory_planning.hpp"
 
 #include "oneapi/dnnl/dnnl.hpp"
 
@@ -28,14 +35,56 @@ namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+// Deduplication reads the content of the constant buffers on the host, so it's
+// only supported for native CPU runtimes. It's also disabled in NUMA aware mode
+// as it would merge the per-node replicas back into a single buffer.
+inline bool is_constant_cache_dedup_enabled(const dnnl::engine &eng) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    if (eng.get()->kind() != engine_kind::cpu) return false;
+    if (cpu::platform::is_numa_aware()) return false;
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    return cache && cache->get_capacity() != 0 && cache->is_dedup_enabled();
+#else
+    UNUSED(eng);
+    return false;
+#endif
+}
+
 struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
     dnnl_constant_buffer_t(
             size_t size, dnnl::engine &engine, graph::allocator_t *alc)
         : graph::constant_buffer_t(
-                size, engine.get(), alc, malloc_func, free_func) {}
+                size, engine.get(), alc, malloc_func, free_func) {
+        // The gaps between the constant tensors are hashed as well, so they
+        // must not contain garbage for the deduplication to work.
+        if (size && is_constant_cache_dedup_enabled(engine))
+            std::memset(data_, 0, size);
+    }
+
+    // Constant buffers hold the packed weights of the compiled partitions. They
+    // are backed by huge pages in the library huge pages mode as long as the
+    // host memory is managed by the library.
+    static bool use_huge_pages(impl::engine_t *eng, graph::allocator_t *alc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+        return eng->kind() == engine_kind::cpu && alc
+                && alc->is_default_host_allocator()
+                && get_huge_pages_mode() != huge_pages_mode::none;
+#else
+        UNUSED(eng);
+        UNUSED(alc);
+        return false;
+#endif
+    }
 
     static void *malloc_func(
             size_t size, impl::engine_t *eng, graph::allocator_t *alc) {
+        if (use_huge_pages(eng, alc))
+            return malloc_huge_pages(size,
+                    graph::utils::cpu_allocator_t::DEFAULT_ALIGNMENT,
+                    huge_pages_mode::any);
         dnnl::engine engine;
         engine.reset(eng, true); // not own
         return dnnl_allocator_t::malloc(
@@ -44,6 +93,10 @@ struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
 
     static void free_func(
             void *data, impl::engine_t *eng, graph::allocator_t *alc) {
+        if (use_huge_pages(eng, alc)) {
+            free_huge_pages(data);
+            return;
+        }
         dnnl::engine engine;
         engine.reset(eng, true); // not own
         if (eng->kind() == engine_kind::cpu) {
@@ -88,6 +141,61 @@ inline bool is_constant_cache_enabled(const dnnl::engine &eng) {
     return cache && cache->get_capacity() != 0;
 }
 
+// Returns a buffer with the same content as the given one which may be shared
+// with other partitions or processes. The constant executables writing to the
+// buffer must have been submitted to the given stream.
+inline graph::constant_tensor_cache_t::cached_t dnnl_constant_cache_dedup(
+        const dnnl::engine &eng, dnnl::stream &strm,
+        const graph::constant_tensor_cache_t::cached_t &buffer,
+        size_t alignment) {
+    if (!is_constant_cache_dedup_enabled(eng)) return buffer;
+    strm.wait();
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    return cache->dedup(buffer, alignment);
+}
+
+// In NUMA aware mode the constant buffers are keyed by the node of the
+// executing thread (see kernel_base_t::encode_constant_cache_key()), but they
+// are computed by the threads of a parallel region which may run on other
+// nodes. The pages of a freshly computed buffer are moved to the node of the
+// executing thread so that each replica is local to the node using it.
+inline void dnnl_constant_cache_place(const dnnl::engine &eng,
+        dnnl::stream &strm,
+        const graph::constant_tensor_cache_t::cached_t &buffer) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    if (eng.get()->kind() != engine_kind::cpu) return;
+    if (!cpu::platform::is_numa_aware()) return;
+    strm.wait();
+    cpu::platform::move_to_numa_node(buffer->data<char>(), buffer->size(),
+            cpu::platform::get_current_numa_node());
+#else
+    UNUSED(eng);
+    UNUSED(strm);
+    UNUSED(buffer);
+#endif
+}
+
+// Deduplicates the constant buffer of a kernel with dnnl_constant_cache_dedup.
+// If it's replaced by a shared buffer, the memories of the execution arguments
+// using the internal persistent buffer are re-granted from the shared one.
+// In NUMA aware mode the buffer is moved to the local node instead.
+inline void dnnl_constant_cache_dedup_and_regrant(const dnnl::engine &eng,
+        dnnl::stream &strm, graph::constant_tensor_cache_t::cached_t &buffer,
+        const memory_planner_t &planner, const execution_args_set_t &res) {
+    dnnl_constant_cache_place(eng, strm, buffer);
+    auto shared_buffer = dnnl_constant_cache_dedup(
+            eng, strm, buffer, planner.internal_persistent_alignment());
+    if (shared_buffer == buffer) return;
+
+    buffer = shared_buffer;
+    grantor_t grantor
+            = planner.internal_persistent_grantor(buffer->data<char>());
+    for (auto &mem_offkey : res.get_mems_use_internal_persistent())
+        mem_offkey.first.set_data_handle(grantor.get(mem_offkey.second));
+}
+
 inline void dnnl_constant_cache_retain(const dnnl::engine &eng) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
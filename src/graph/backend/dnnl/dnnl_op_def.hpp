@@ -318,6 +318,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_convolution, 1,
                 .set_attr(
                         op_attr::canonicalized, false, attribute_kind::b, false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                .set_attr(op_attr::prefer_plain_layout, false,
+                        attribute_kind::b, false)
                 // Analysis rules
                 .set_shape_inference_function(infer_dnnl_conv_output_shape)
                 .SET_LAYOUT_PROPAGATOR(layout_propagator_for_conv)
@@ -986,6 +988,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_matmul, 1,
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 .set_attr(op_attr::keep_dst_layout, false, attribute_kind::b,
                         false)
+                .set_attr(op_attr::prefer_plain_layout, false,
+                        attribute_kind::b, false)
                 // Analysis rules
                 .set_shape_inference_function(infer_matmul_output_shape)
                 .SET_LAYOUT_PROPAGATOR(layout_propagator_for_matmul)
@@ -128,18 +128,27 @@ status_t dnnl_partition_impl_t::compile(
         kernel_creator = large_partition_kernel_creator;
     }
 
-    // Dispatch to fake kernel if one of the output dimensions is zero.
-    const std::vector<std::shared_ptr<op_t>> &fused_op = part->get_ops();
-    auto fpm = get_fpmath_mode();
-    auto agraph = graph_t(fused_op, get_engine_kind());
-    agraph.set_fpmath_mode(fpm.mode_, fpm.apply_to_int_);
-    agraph.set_user_inputs_outputs(inputs, outputs);
-    agraph.infer_shape();
-    for (const auto &val : agraph.get_output_values()) {
-        if (logical_tensor_wrapper_t(val->get_logical_tensor())
-                        .has_zero_dim()) {
-            kernel_creator = dummy_kernel_creator;
-            break;
+    if (dynamic_shape_kernel_t::has_unknown_dims(inputs)
+            && dynamic_shape_kernel_t::get_capacity() > 0) {
+        // Defer the compilation to the execution, where the concrete shapes
+        // are known. The zero dimension check is done there as well.
+        kernel_creator = [kernel_creator]() -> kernel_ptr {
+            return std::make_shared<dynamic_shape_kernel_t>(kernel_creator);
+        };
+    } else {
+        // Dispatch to fake kernel if one of the output dimensions is zero.
+        const std::vector<std::shared_ptr<op_t>> &fused_op = part->get_ops();
+        auto fpm = get_fpmath_mode();
+        auto agraph = graph_t(fused_op, get_engine_kind());
+        agraph.set_fpmath_mode(fpm.mode_, fpm.apply_to_int_);
+        agraph.set_user_inputs_outputs(inputs, outputs);
+        agraph.infer_shape();
+        for (const auto &val : agraph.get_output_values()) {
+            if (logical_tensor_wrapper_t(val->get_logical_tensor())
+                            .has_zero_dim()) {
+                kernel_creator = dummy_kernel_creator;
+                break;
+            }
         }
     }
 
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "graph/backend/dnnl/exec_tracer.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+std::string get_trace_file() {
+    // Not read with getenv_string_user() as the path is case sensitive.
+    const int len = 1024;
+    char value[len];
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        const std::string name
+                = std::string(prefix) + "GRAPH_EXEC_TRACE_FILE";
+        if (dnnl::impl::getenv(name.c_str(), value, len) > 0) return value;
+    }
+    return std::string();
+}
+
+struct trace_event_t {
+    std::string name;
+    size_t op_id;
+    int tid;
+    double start_ms;
+    double duration_ms;
+};
+
+// Collects the events of the process and writes them to the trace file at
+// exit.
+class trace_recorder_t {
+public:
+    static trace_recorder_t &get() {
+        static trace_recorder_t recorder;
+        return recorder;
+    }
+
+    ~trace_recorder_t() { dump(); }
+
+    bool has_file() const { return !file_.empty(); }
+
+    // Threads are numbered in the order they run their first executable.
+    int thread_index() {
+        thread_local int index = -1;
+        if (index < 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            index = n_threads_++;
+        }
+        return index;
+    }
+
+    void record(trace_event_t &&event) {
+        if (!has_file()) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(std::move(event));
+    }
+
+private:
+    trace_recorder_t() : file_(get_trace_file()) {}
+
+    static std::string escape(const std::string &s) {
+        std::string res;
+        for (const char c : s) {
+            if (c == '"' || c == '\\') res += '\\';
+            res += c;
+        }
+        return res;
+    }
+
+    void dump() const {
+        if (!has_file() || events_.empty()) return;
+        std::ofstream out(file_);
+        if (!out) return;
+        // Timestamps and durations are expected in microseconds.
+        out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+        for (size_t i = 0; i < events_.size(); i++) {
+            const auto &e = events_[i];
+            out << (i ? ",\n" : "\n") << "{\"name\":\"" << escape(e.name)
+                << "\",\"cat\":\"graph\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                << e.tid << ",\"ts\":" << e.start_ms * 1e3
+                << ",\"dur\":" << e.duration_ms * 1e3
+                << ",\"args\":{\"op_id\":" << e.op_id << "}}";
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    const std::string file_;
+    std::mutex mutex_;
+    int n_threads_ = 0;
+    std::vector<trace_event_t> events_;
+};
+
+bool exec_trace_print() {
+    static const bool print = getenv_int_user("GRAPH_EXEC_TRACE") != 0;
+    return print;
+}
+
+class traced_executable_t : public op_executable_t {
+public:
+    traced_executable_t(
+            const std::shared_ptr<op_executable_t> &exec, const op_t &op)
+        : exec_(exec), name_(op.get_name()), op_id_(op.get_id()) {}
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        // A copy of the handle, waiting does not change the stream.
+        auto strm = stream;
+        strm.wait();
+        const double start_ms = get_msec();
+        exec_->execute(stream, args);
+        strm.wait();
+        record(start_ms);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        ::sycl::event::wait(deps);
+        const double start_ms = get_msec();
+        auto e = exec_->execute_sycl(stream, args, deps);
+        e.wait();
+        record(start_ms);
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        if (!deps.empty())
+            clWaitForEvents(static_cast<cl_uint>(deps.size()), deps.data());
+        const double start_ms = get_msec();
+        cl_event e = exec_->execute_ocl(stream, args, deps);
+        if (e) clWaitForEvents(1, &e);
+        record(start_ms);
+        return e;
+    }
+#endif
+
+private:
+    void record(double start_ms) const {
+        const double duration_ms = get_msec() - start_ms;
+        auto &recorder = trace_recorder_t::get();
+        const int tid = recorder.thread_index();
+        if (exec_trace_print()) {
+            VFORMAT(start_ms, verbose_t::exec_profile, graph, exec, ":trace",
+                    "%s,%zu,%d,%g", name_.c_str(), op_id_, tid, duration_ms);
+        }
+        recorder.record({name_, op_id_, tid, start_ms, duration_ms});
+    }
+
+    std::shared_ptr<op_executable_t> exec_;
+    std::string name_;
+    size_t op_id_;
+};
+
+} // namespace
+
+bool exec_trace_enabled() {
+    static const bool enabled
+            = exec_trace_print() || trace_recorder_t::get().has_file();
+    return enabled;
+}
+
+std::shared_ptr<op_executable_t> make_traced_executable(
+        const std::shared_ptr<op_executable_t> &exec, const op_t &op) {
+    return std::make_shared<traced_executable_t>(exec, op);
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+#ifndef GRAPH_BACKEND_DNNL_EXEC_TRACER_HPP
+#define GRAPH_BACKEND_DNNL_EXEC_TRACER_HPP
+
+#include <memory>
+
+#include "graph/interface/op.hpp"
+
+#include "graph/backend/dnnl/op_executable.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Opt-in tracing of the executables a compiled partition is made of: fused
+// primitives, internal ops and the reorders inserted by the backend.
+//
+// ONEDNN_GRAPH_EXEC_TRACE=1 times every call of every executable and prints
+// it as a verbose line:
+//   onednn_verbose,graph,exec:trace,<op name>,<op id>,<thread>,<time in ms>
+// ONEDNN_GRAPH_EXEC_TRACE_FILE=<path> enables tracing as well and writes all
+// the events at exit to <path> in the Chrome trace event format, which can be
+// loaded into chrome://tracing or Perfetto.
+//
+// The stream is waited on around every call, so the timings are exact but
+// the execution is serialized.
+bool exec_trace_enabled();
+
+// Returns an executable that runs `exec` and traces each call as `op`.
+std::shared_ptr<op_executable_t> make_traced_executable(
+        const std::shared_ptr<op_executable_t> &exec, const op_t &op);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "graph/backend/dnnl/inter_op_scheduler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+// Below this amount of bytes per thread, giving more threads to an op doesn't
+// make it faster.
+constexpr size_t min_bytes_per_thread = 32 * 1024;
+// The cost of a fork/join expressed in the same unit as the op costs (bytes).
+constexpr size_t parallel_region_overhead = 16 * 1024;
+
+struct buffer_access_t {
+    uintptr_t begin;
+    uintptr_t end;
+    bool is_write;
+};
+
+bool is_write_arg(int arg) {
+    if (arg >= DNNL_ARG_MULTIPLE_DST && arg < DNNL_ARG_ATTR_SCALES)
+        return true;
+    switch (arg) {
+        case DNNL_ARG_DST_0:
+        case DNNL_ARG_DST_1:
+        case DNNL_ARG_DST_2:
+        case DNNL_ARG_MEAN:
+        case DNNL_ARG_VARIANCE:
+        case DNNL_ARG_WORKSPACE:
+        case DNNL_ARG_SCRATCHPAD:
+        case DNNL_ARG_DIFF_SRC_0:
+        case DNNL_ARG_DIFF_SRC_1:
+        case DNNL_ARG_DIFF_SRC_2:
+        case DNNL_ARG_DIFF_SRC_3:
+        case DNNL_ARG_DIFF_WEIGHTS_0:
+        case DNNL_ARG_DIFF_WEIGHTS_1:
+        case DNNL_ARG_DIFF_WEIGHTS_2:
+        case DNNL_ARG_DIFF_WEIGHTS_3:
+        case DNNL_ARG_DIFF_BIAS:
+        case DNNL_ARG_DIFF_SCALE:
+        case DNNL_ARG_DIFF_SHIFT: return true;
+        default: return false;
+    }
+}
+
+std::vector<buffer_access_t> get_buffer_accesses(const exec_args &args) {
+    std::vector<buffer_access_t> accesses;
+    accesses.reserve(args.size());
+    for (const auto &arg : args) {
+        if (!arg.second) continue;
+        const auto begin
+                = reinterpret_cast<uintptr_t>(arg.second.get_data_handle());
+        const size_t size = arg.second.get_desc().get_size();
+        if (begin == 0 || size == 0) continue;
+        accesses.push_back({begin, begin + size, is_write_arg(arg.first)});
+    }
+    return accesses;
+}
+
+bool has_hazard(const std::vector<buffer_access_t> &a,
+        const std::vector<buffer_access_t> &b) {
+    for (const auto &x : a) {
+        for (const auto &y : b) {
+            if (!x.is_write && !y.is_write) continue;
+            if (x.begin < y.end && y.begin < x.end) return true;
+        }
+    }
+    return false;
+}
+
+// Estimated time to execute an op of the given cost with nthr threads
+float estimate_time(size_t cost, int nthr) {
+    const size_t useful_nthr = std::max<size_t>(1,
+            std::min<size_t>(
+                    static_cast<size_t>(nthr), cost / min_bytes_per_thread));
+    return static_cast<float>(cost) / useful_nthr
+            + (useful_nthr > 1 ? parallel_region_overhead : 0);
+}
+
+} // namespace
+
+std::vector<std::vector<size_t>> inter_op_scheduler_t::build_waves(
+        const std::vector<bool> &is_constant,
+        const std::vector<exec_args> &args) {
+    assertm(is_constant.size() == args.size(),
+            "the number of execution args doesn't match executables");
+
+    std::vector<size_t> ids;
+    std::vector<std::vector<buffer_access_t>> accesses;
+    for (size_t i = 0; i < args.size(); i++) {
+        if (is_constant[i]) continue;
+        ids.push_back(i);
+        accesses.emplace_back(get_buffer_accesses(args[i]));
+    }
+
+    // An executable must run after all the previous executables it has a
+    // hazard with, so its wave is one after the latest of them.
+    std::vector<size_t> wave_of(ids.size(), 0);
+    size_t num_waves = 0;
+    for (size_t i = 0; i < ids.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (wave_of[j] + 1 > wave_of[i]
+                    && has_hazard(accesses[i], accesses[j]))
+                wave_of[i] = wave_of[j] + 1;
+        }
+        num_waves = std::max(num_waves, wave_of[i] + 1);
+    }
+
+    std::vector<std::vector<size_t>> waves(num_waves);
+    for (size_t i = 0; i < ids.size(); i++)
+        waves[wave_of[i]].push_back(ids[i]);
+    return waves;
+}
+
+inter_op_scheduler_t::wave_plan_t inter_op_scheduler_t::plan_wave(
+        const std::vector<size_t> &costs, int nthr, int max_team_nthr) {
+    wave_plan_t seq_plan;
+    seq_plan.teams.emplace_back(costs.size());
+    std::iota(seq_plan.teams[0].begin(), seq_plan.teams[0].end(), 0);
+    seq_plan.team_nthr.push_back(nthr);
+
+    const size_t nteams = std::min(costs.size(), static_cast<size_t>(nthr));
+    if (nteams < 2 || max_team_nthr < 1) return seq_plan;
+
+    float seq_time = 0.f;
+    for (const auto c : costs)
+        seq_time += estimate_time(c, nthr);
+
+    // Longest processing time first: assign the ops by decreasing cost to the
+    // least loaded team.
+    std::vector<size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+    wave_plan_t plan;
+    plan.teams.resize(nteams);
+    std::vector<size_t> loads(nteams, 0);
+    for (const auto op : order) {
+        const size_t t = static_cast<size_t>(
+                std::min_element(loads.begin(), loads.end()) - loads.begin());
+        plan.teams[t].push_back(op);
+        loads[t] += costs[op];
+    }
+    for (auto &team : plan.teams)
+        std::sort(team.begin(), team.end());
+
+    // Each team gets at least one thread, the remaining ones are split
+    // proportionally to the team loads.
+    const size_t total_load
+            = std::max<size_t>(1, std::accumulate(loads.begin(), loads.end(),
+                                          static_cast<size_t>(0)));
+    const size_t spare_nthr = static_cast<size_t>(nthr) - nteams;
+    plan.team_nthr.resize(nteams, 1);
+    if (max_team_nthr > 1) {
+        int assigned = 0;
+        for (size_t t = 0; t < nteams; t++) {
+            plan.team_nthr[t] += static_cast<int>(
+                    static_cast<double>(spare_nthr) * loads[t] / total_load);
+            assigned += plan.team_nthr[t];
+        }
+        for (size_t t = 0; assigned < nthr; t = (t + 1) % nteams) {
+            plan.team_nthr[t]++;
+            assigned++;
+        }
+        for (auto &n : plan.team_nthr)
+            n = std::min(n, max_team_nthr);
+    }
+
+    float par_time = 0.f;
+    for (size_t t = 0; t < nteams; t++) {
+        float team_time = 0.f;
+        for (const auto op : plan.teams[t])
+            team_time += estimate_time(costs[op], plan.team_nthr[t]);
+        par_time = std::max(par_time, team_time);
+    }
+    par_time += parallel_region_overhead;
+
+    return par_time < seq_time ? plan : seq_plan;
+}
+
+size_t inter_op_scheduler_t::estimate_cost(const exec_args &args) {
+    size_t cost = 0;
+    for (const auto &arg : args) {
+        if (!arg.second || arg.first == DNNL_ARG_SCRATCHPAD) continue;
+        cost += arg.second.get_desc().get_size();
+    }
+    return cost;
+}
+
+void inter_op_scheduler_t::execute(const stream &p_stream,
+        const std::vector<std::shared_ptr<op_executable_t>> &execs,
+        const std::vector<bool> &is_constant,
+        const std::vector<exec_args> &args) {
+    const int nthr = dnnl_get_current_num_threads();
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // The library doesn't use nested parallelism, so each op executed inside
+    // a team runs single-threaded.
+    const int max_team_nthr = 1;
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    const int max_team_nthr = nthr;
+#else
+    const int max_team_nthr = 0;
+#endif
+
+    for (const auto &wave : build_waves(is_constant, args)) {
+        wave_plan_t plan;
+        if (wave.size() > 1) {
+            std::vector<size_t> costs;
+            costs.reserve(wave.size());
+            for (const auto i : wave)
+                costs.push_back(estimate_cost(args[i]));
+            plan = plan_wave(costs, nthr, max_team_nthr);
+        }
+
+        if (!plan.is_concurrent()) {
+            for (const auto i : wave)
+                execs[i]->execute(p_stream, args[i]);
+            continue;
+        }
+
+        const auto run_team = [&](size_t t) {
+            for (const auto pos : plan.teams[t])
+                execs[wave[pos]]->execute(p_stream, args[wave[pos]]);
+        };
+        const int nteams = static_cast<int>(plan.teams.size());
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+        std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+        arenas.reserve(nteams);
+        for (int t = 0; t < nteams; t++)
+            arenas.emplace_back(impl::utils::make_unique<tbb::task_arena>(
+                    plan.team_nthr[t]));
+        tbb::parallel_for(
+                0, nteams,
+                [&](int t) { arenas[t]->execute([&]() { run_team(t); }); },
+                tbb::static_partitioner());
+#else
+        parallel(nteams, [&](int ithr, int nthr_) {
+            for (int t = ithr; t < nteams; t += nthr_)
+                run_team(t);
+        });
+#endif
+    }
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
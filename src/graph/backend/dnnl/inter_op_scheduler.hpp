@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+#ifndef GRAPH_BACKEND_DNNL_INTER_OP_SCHEDULER_HPP
+#define GRAPH_BACKEND_DNNL_INTER_OP_SCHEDULER_HPP
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// The inter-op scheduler executes the op executables of a compiled subgraph
+// following their data dependencies instead of strictly following the
+// topological order in which they were created. Executables that don't depend
+// on each other (eg. the branches of an inception block or the experts of a MoE
+// layer) are grouped into waves, and a wave can be executed concurrently by
+// several thread teams when the cost model estimates that splitting the cores
+// is faster than executing the ops one by one with all threads.
+//
+// The dependencies are derived from the memory buffers bound to the execution
+// args, so read-after-write, write-after-read and write-after-write hazards
+// between executables are respected whatever the memory planner decided.
+//
+// Only the CPU engine is supported. With OpenMP, nested parallelism is not
+// allowed in the library, so each team consists of a single thread. With TBB,
+// each team is a task arena sized by the cost model. Other threading runtimes
+// always execute the waves sequentially.
+class inter_op_scheduler_t {
+public:
+    // A plan to execute a wave: each team executes its ops one by one using
+    // the given number of threads.
+    struct wave_plan_t {
+        std::vector<std::vector<size_t>> teams;
+        std::vector<int> team_nthr;
+
+        bool is_concurrent() const { return teams.size() > 1; }
+    };
+
+    // Groups the non-constant executables into waves. Each wave only depends
+    // on the waves before it, and the executables inside a wave are
+    // independent. Indices are kept in ascending order inside each wave.
+    static std::vector<std::vector<size_t>> build_waves(
+            const std::vector<bool> &is_constant,
+            const std::vector<exec_args> &args);
+
+    // Decides how to execute a wave of independent ops with the given
+    // estimated costs on nthr threads. A non-concurrent plan is returned if
+    // the cost model prefers sequential execution.
+    static wave_plan_t plan_wave(const std::vector<size_t> &costs, int nthr,
+            int max_team_nthr);
+
+    // Estimated cost of an executable, which is the total number of bytes
+    // touched by its execution args.
+    static size_t estimate_cost(const exec_args &args);
+
+    // Executes all non-constant executables on the given stream
+    static void execute(const stream &p_stream,
+            const std::vector<std::shared_ptr<op_executable_t>> &execs,
+            const std::vector<bool> &is_constant,
+            const std::vector<exec_args> &args);
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -48,6 +48,7 @@ const op_attr_t keep_dst_layout = 0x1000f;
 const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
+const op_attr_t prefer_plain_layout = 0x10013;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -92,6 +93,7 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(with_scale);
         CASE(is_invert_scale);
         CASE(mask_type);
+        CASE(prefer_plain_layout);
         CASE(alg_kind);
         CASE(fusion_info_key);
         CASE(axis_row);
@@ -0,0 +1,349 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <set>
+#include <string>
+
+#include "common/utils.hpp"
+
+#include "graph/interface/logical_tensor.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/kernels/dummy.hpp"
+#include "graph/backend/dnnl/kernels/dynamic_shape.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+size_t dynamic_shape_kernel_t::get_capacity() {
+    const int capacity = dnnl::impl::getenv_int_user(
+            "GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", 0);
+    return capacity > 0 ? static_cast<size_t>(capacity) : 0;
+}
+
+bool dynamic_shape_kernel_t::has_unknown_dims(
+        const std::vector<logical_tensor_t> &lts) {
+    for (const auto &lt : lts) {
+        const logical_tensor_wrapper_t ltw(lt);
+        if (!ltw.is_empty() && ltw.is_shape_unknown()) return true;
+    }
+    return false;
+}
+
+bool dynamic_shape_kernel_t::can_bucket_leading_dim(
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) const {
+    const auto is_only_leading_dim_unknown = [](const logical_tensor_t &lt) {
+        if (lt.ndims < 1 || lt.dims[0] != DNNL_GRAPH_UNKNOWN_DIM) return false;
+        for (int d = 1; d < lt.ndims; d++)
+            if (lt.dims[d] == DNNL_GRAPH_UNKNOWN_DIM) return false;
+        return true;
+    };
+    for (const auto &in : inputs) {
+        if (logical_tensor_wrapper_t(in).is_shape_unknown()
+                && !is_only_leading_dim_unknown(in))
+            return false;
+    }
+    for (const auto &out : outputs) {
+        if (!is_only_leading_dim_unknown(out)) return false;
+    }
+
+    using namespace graph::op_kind;
+
+    // Ops which compute each element of the leading (batch) dimension of
+    // their activations independently, as long as they don't reduce or
+    // normalize along it, which is checked below.
+    static const std::set<op_kind_t> batch_independent_ops
+            = {Abs, Add, AvgPool, BatchNormInference, BiasAdd, Clamp,
+                    Convolution, ConvTranspose, Dequantize, Divide, Elu, Exp,
+                    GELU, GroupNorm, HardSigmoid, HardSwish, Interpolate,
+                    LayerNorm, LeakyReLU, Log, LogSoftmax, MatMul, Maximum,
+                    MaxPool, Minimum, Mish, Multiply, Pow, PReLU, Quantize,
+                    Reciprocal, ReLU, Reorder, Round, Select, Sigmoid, SoftMax,
+                    SoftPlus, Sqrt, Square, SquaredDifference, Subtract, Tanh,
+                    TypeCast};
+
+    const auto get_axis = [](const op_t *op, op_attr_t attr, int64_t def) {
+        return op->has_attr(attr) ? op->get_attr<int64_t>(attr) : def;
+    };
+    // An axis is on the leading dimension if it is 0 or if it can't be
+    // told as the rank is unknown.
+    const auto is_leading_axis = [](int64_t axis, int32_t ndims) {
+        return axis == 0 || (axis < 0 && (ndims < 0 || axis + ndims <= 0));
+    };
+
+    for (const auto &op : part_->get_ops()) {
+        const op_kind_t kind = op->get_kind();
+        if (!batch_independent_ops.count(kind)) return false;
+
+        // Broadcasting aligns the trailing dimensions, so an input of lower
+        // rank doesn't have the leading dimension to be sliced.
+        const logical_tensor_t src
+                = op->get_input_value(0)->get_logical_tensor();
+        for (const auto &in_val : op->get_input_values()) {
+            const logical_tensor_t in = in_val->get_logical_tensor();
+            if (logical_tensor_wrapper_t(in).is_shape_unknown()
+                    && in.ndims != src.ndims)
+                return false;
+        }
+
+        if (kind == SoftMax
+                && is_leading_axis(get_axis(op.get(), op_attr::axis, 1),
+                        src.ndims))
+            return false;
+        if (kind == LogSoftmax
+                && is_leading_axis(get_axis(op.get(), op_attr::axis, -1),
+                        src.ndims))
+            return false;
+        if (kind == LayerNorm
+                && is_leading_axis(
+                        get_axis(op.get(), op_attr::begin_norm_axis, -1),
+                        src.ndims))
+            return false;
+        if (impl::utils::one_of(kind, Quantize, Dequantize)
+                && op->has_attr(op_attr::qtype)
+                && op->get_attr<std::string>(op_attr::qtype) != "per_tensor"
+                && is_leading_axis(
+                        get_axis(op.get(), op_attr::axis, 1), src.ndims))
+            return false;
+        if (kind == MatMul) {
+            // The leading dimension of a 2D matrix is only the batch of rows
+            // of a non transposed src, and the weights must not depend on it.
+            const bool transpose_a = op->has_attr(op_attr::transpose_a)
+                    && op->get_attr<bool>(op_attr::transpose_a);
+            const logical_tensor_t wei
+                    = op->get_input_value(1)->get_logical_tensor();
+            if (transpose_a && src.ndims <= 2) return false;
+            if (wei.ndims <= 2
+                    && logical_tensor_wrapper_t(wei).is_shape_unknown())
+                return false;
+        }
+    }
+    return true;
+}
+
+status_t dynamic_shape_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_engine_ = g_engine;
+    capacity_ = get_capacity();
+    if (capacity_ == 0) return status::unimplemented;
+
+    // Keep a pristine copy of the partition as compiling a kernel transforms
+    // the partition it is given.
+    part_ = std::dynamic_pointer_cast<dnnl_partition_impl_t>(part->clone());
+
+    for (const auto &in : inputs)
+        given_lts_[in.id] = in;
+    for (const auto &out : outputs)
+        given_lts_[out.id] = out;
+
+    bucket_leading_dim_ = can_bucket_leading_dim(inputs, outputs);
+
+    // The layout of the outputs is only known at execution time
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto &out = const_cast<logical_tensor_t &>(outputs[i]);
+        if (logical_tensor_wrapper_t(out).is_any()) {
+            out.layout_type = layout_type::strided;
+            for (int d = 0; d < out.ndims; d++)
+                out.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+        }
+    }
+
+    return status::success;
+}
+
+status_t dynamic_shape_kernel_t::get_or_compile_kernel(
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, kernel_ptr &kernel) {
+    key_t key;
+    std::vector<logical_tensor_t> ins, outs;
+    bool has_zero_dim_output = false;
+
+    const auto get_concrete_lts = [&](const std::vector<tensor_t> &tensors,
+                                          std::vector<logical_tensor_t> &lts) {
+        lts.reserve(tensors.size());
+        for (const auto &t : tensors) {
+            const auto pos = given_lts_.find(t.get_logical_tensor().id);
+            if (pos == given_lts_.end()) return status::invalid_arguments;
+
+            logical_tensor_t lt = t.get_logical_tensor();
+            const logical_tensor_wrapper_t ltw(lt);
+            if (ltw.is_shape_unknown() || !ltw.is_strided()
+                    || ltw.is_stride_unknown())
+                return status::invalid_arguments;
+            lt.property = pos->second.property;
+
+            key.push_back(static_cast<dim_t>(lt.id));
+            key.push_back(static_cast<dim_t>(lt.data_type));
+            key.push_back(lt.ndims);
+            key.insert(key.end(), lt.dims, lt.dims + lt.ndims);
+            key.insert(key.end(), lt.layout.strides,
+                    lt.layout.strides + lt.ndims);
+            lts.push_back(lt);
+        }
+        return status::success;
+    };
+    CHECK(get_concrete_lts(inputs, ins));
+    CHECK(get_concrete_lts(outputs, outs));
+    for (const auto &out : outs)
+        has_zero_dim_output = has_zero_dim_output
+                || logical_tensor_wrapper_t(out).has_zero_dim();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = kernels_.find(key);
+        if (it != kernels_.end()) {
+            lru_list_.splice(lru_list_.begin(), lru_list_, it->second.second);
+            kernel = it->second.first;
+            return status::success;
+        }
+    }
+
+    // Compile outside of the lock so that executions of other shapes are not
+    // blocked. If several threads miss on the same shape, the first inserted
+    // kernel wins.
+    auto part
+            = std::dynamic_pointer_cast<dnnl_partition_impl_t>(part_->clone());
+    kernel_ptr new_kernel
+            = has_zero_dim_output ? dummy_kernel_creator() : kernel_creator_();
+    if (!new_kernel) return status::unimplemented;
+    CHECK(new_kernel->compile(part.get(), g_engine_, ins, outs));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_compilations_++;
+    auto it = kernels_.find(key);
+    if (it != kernels_.end()) {
+        kernel = it->second.first;
+        return status::success;
+    }
+    lru_list_.push_front(key);
+    kernels_.emplace(key, std::make_pair(new_kernel, lru_list_.begin()));
+    if (kernels_.size() > capacity_) {
+        kernels_.erase(lru_list_.back());
+        lru_list_.pop_back();
+    }
+    kernel = new_kernel;
+    return status::success;
+}
+
+status_t dynamic_shape_kernel_t::execute_bucketed(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    // The concrete size of the leading dimension, which must be the same for
+    // all tensors where it is unknown at compilation.
+    dim_t size = DNNL_GRAPH_UNKNOWN_DIM;
+    std::vector<bool> in_sliced(inputs.size()), out_sliced(outputs.size());
+    const auto check_sliced = [&](const std::vector<tensor_t> &tensors,
+                                      std::vector<bool> &sliced) {
+        for (size_t i = 0; i < tensors.size(); i++) {
+            const auto &lt = tensors[i].get_logical_tensor();
+            const auto pos = given_lts_.find(lt.id);
+            if (pos == given_lts_.end()) return false;
+            sliced[i] = logical_tensor_wrapper_t(pos->second)
+                                .is_shape_unknown();
+            if (!sliced[i]) continue;
+            if (lt.ndims < 1 || lt.dims[0] <= 0
+                    || lt.layout_type != layout_type::strided)
+                return false;
+            if (size == DNNL_GRAPH_UNKNOWN_DIM) size = lt.dims[0];
+            if (lt.dims[0] != size) return false;
+        }
+        return true;
+    };
+    if (!check_sliced(inputs, in_sliced) || !check_sliced(outputs, out_sliced))
+        return status::unimplemented;
+
+    const auto make_slices = [&](const std::vector<tensor_t> &tensors,
+                                     const std::vector<bool> &sliced,
+                                     dim_t offset, dim_t chunk) {
+        std::vector<tensor_t> slices;
+        slices.reserve(tensors.size());
+        for (size_t i = 0; i < tensors.size(); i++) {
+            if (!sliced[i]) {
+                slices.push_back(tensors[i]);
+                continue;
+            }
+            logical_tensor_t lt = tensors[i].get_logical_tensor();
+            const logical_tensor_wrapper_t ltw(lt);
+            auto *handle = static_cast<char *>(tensors[i].get_data_handle())
+                    + offset * lt.layout.strides[0] * ltw.data_type_size();
+            lt.dims[0] = chunk;
+            slices.emplace_back(lt, tensors[i].get_engine(), handle);
+        }
+        return slices;
+    };
+
+    // Run the power of two buckets of the binary decomposition of the size,
+    // largest first.
+    dim_t offset = 0;
+    for (dim_t chunk = dim_t(1) << (8 * sizeof(dim_t) - 2); chunk > 0;
+            chunk >>= 1) {
+        if (!(size & chunk)) continue;
+        const auto ins = make_slices(inputs, in_sliced, offset, chunk);
+        const auto outs = make_slices(outputs, out_sliced, offset, chunk);
+        kernel_ptr kernel;
+        CHECK(get_or_compile_kernel(ins, outs, kernel));
+        CHECK(kernel->execute(g_stream, ins, outs));
+        offset += chunk;
+    }
+    return status::success;
+}
+
+status_t dynamic_shape_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    if (bucket_leading_dim_) {
+        const status_t status = execute_bucketed(g_stream, inputs, outputs);
+        if (status != status::unimplemented) return status;
+    }
+    kernel_ptr kernel;
+    CHECK(get_or_compile_kernel(inputs, outputs, kernel));
+    return kernel->execute(g_stream, inputs, outputs);
+}
+
+#ifdef DNNL_WITH_SYCL
+status_t dynamic_shape_kernel_t::sycl_execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs,
+        const std::vector<::sycl::event> &sycl_deps,
+        ::sycl::event *sycl_event) {
+    kernel_ptr kernel;
+    CHECK(get_or_compile_kernel(inputs, outputs, kernel));
+    return kernel->execute_sycl(
+            g_stream, inputs, outputs, sycl_deps, sycl_event);
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+status_t dynamic_shape_kernel_t::ocl_execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs,
+        const std::vector<cl_event> &cl_deps, cl_event *ret_event) {
+    kernel_ptr kernel;
+    CHECK(get_or_compile_kernel(inputs, outputs, kernel));
+    return kernel->execute_ocl(g_stream, inputs, outputs, cl_deps, ret_event);
+}
+#endif
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
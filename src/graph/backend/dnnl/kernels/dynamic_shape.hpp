@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// A kernel for partitions compiled with unknown input dimensions (eg. a
+// variable sequence length). The compilation only records the partition and
+// the kernel creator, and the real kernel is compiled at execution time for
+// the concrete shapes of the given tensors. The compiled kernels are kept in
+// a per compiled partition LRU cache keyed by the shapes and strides of all
+// inputs and outputs, so each distinct shape is compiled only once as long as
+// it stays in the cache.
+//
+// On CPU, when only the leading dimension of the inputs and outputs is unknown
+// and all ops of the partition compute each element of that dimension
+// independently (eg. a batch of convolutions, matmuls or eltwise ops), the
+// leading dimension is bucketed instead: kernels are compiled for power of two
+// sizes only and an execution runs the kernels for the binary decomposition of
+// the concrete size on the corresponding slices of the tensors. This bounds
+// the number of compiled kernels by the log of the largest size for any number
+// of distinct sizes. Other partitions compile a kernel per distinct shape.
+//
+// The mode is opt-in: it is enabled by setting the cache capacity with
+// ONEDNN_GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY to a positive number of kernels.
+// Outputs with `any` layout are reported as strided with unknown strides, and
+// the tensors given at execution must have concrete dims and strides.
+struct dynamic_shape_kernel_t : public kernel_base_t {
+private:
+    using key_t = std::vector<dim_t>;
+
+    FCreateKernel kernel_creator_;
+    std::shared_ptr<dnnl_partition_impl_t> part_;
+    const engine_t *g_engine_ = nullptr;
+    size_t capacity_ = 0;
+
+    // The logical tensors given at compilation, indexed by ids. They carry the
+    // properties (eg. constant) which are not attached to the tensors.
+    std::unordered_map<size_t, logical_tensor_t> given_lts_;
+
+    // Set if the leading dimension is bucketed, see above.
+    bool bucket_leading_dim_ = false;
+
+    std::mutex mutex_;
+    std::list<key_t> lru_list_;
+    std::map<key_t, std::pair<kernel_ptr, std::list<key_t>::iterator>>
+            kernels_;
+    size_t num_compilations_ = 0;
+
+    // Checks if every element of the leading dimension can be computed
+    // independently, so that the partition can be executed on slices of it.
+    bool can_bucket_leading_dim(const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) const;
+
+    status_t get_or_compile_kernel(const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, kernel_ptr &kernel);
+
+    // Executes the bucketed kernels on slices of the leading dimension.
+    // Returns unimplemented if the tensors do not match the bucketing, eg.
+    // an empty leading dimension.
+    status_t execute_bucketed(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs);
+
+public:
+    dynamic_shape_kernel_t(const FCreateKernel &kernel_creator)
+        : kernel_creator_(kernel_creator) {}
+
+    ~dynamic_shape_kernel_t() override = default;
+
+    // Returns the capacity of the per compiled partition kernel cache, 0 means
+    // the dynamic shape mode is disabled.
+    static size_t get_capacity();
+
+    // Checks if any of the given logical tensors has unknown dimensions.
+    static bool has_unknown_dims(const std::vector<logical_tensor_t> &lts);
+
+    // Number of kernels currently compiled for concrete shapes
+    size_t get_num_compiled_kernels() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return kernels_.size();
+    }
+
+    // Number of kernel compilations since the partition was compiled,
+    // including recompilations of shapes evicted from the cache
+    size_t get_num_compilations() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_compilations_;
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override;
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps, cl_event *ret_event) override;
+#endif
+
+    DEF_KERNEL_METHOD_STR(dynamic_shape_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dynamic_shape_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -171,6 +171,7 @@ status_t eltwise_fwd_t<quantized>::execute_impl(const stream_t *g_stream,
                         p_stream, res->get_exec_args()[i]);
             }
 
+            dnnl_constant_cache_place(p_engine_, p_stream, c_buffer);
             c_promise.set_value(c_buffer);
         }
     }
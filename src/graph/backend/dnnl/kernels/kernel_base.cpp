@@ -14,6 +14,8 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include "cpu/platform.hpp"
+
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 
@@ -53,6 +55,15 @@ size_t kernel_base_t::encode_constant_cache_key(
                     reinterpret_cast<uintptr_t>(in.get_data_handle()));
         }
     }
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    // Replicate the constant buffers per NUMA node of the executing thread.
+    // Once computed, a replica is moved to this node by
+    // dnnl_constant_cache_place().
+    if (p_engine_.get_kind() == dnnl::engine::kind::cpu
+            && cpu::platform::is_numa_aware())
+        encoded_cache_key = hash_combine(
+                encoded_cache_key, cpu::platform::get_current_numa_node());
+#endif
     return encoded_cache_key;
 }
 
@@ -23,6 +23,7 @@
 #include "graph/backend/dnnl/kernels/conv.hpp"
 #include "graph/backend/dnnl/kernels/conv_transpose.hpp"
 #include "graph/backend/dnnl/kernels/dummy.hpp"
+#include "graph/backend/dnnl/kernels/dynamic_shape.hpp"
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
 #include "graph/backend/dnnl/kernels/gen_index.hpp"
 #include "graph/backend/dnnl/kernels/group_norm.hpp"
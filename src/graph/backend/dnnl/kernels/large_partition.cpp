@@ -25,6 +25,7 @@
 #include "graph/backend/dnnl/passes/transform.hpp"
 #include "graph/backend/dnnl/passes/utils.hpp"
 
+#include "graph/backend/dnnl/inter_op_scheduler.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 
 namespace dnnl {
@@ -208,6 +209,14 @@ status_t larger_partition_kernel_t::compile_impl(
     g_alloc_
             = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
 
+    // Set _ONEDNN_GRAPH_INTER_OP_PARALLEL=1 to execute the independent ops of
+    // the partition concurrently. The ops may then run out of topological
+    // order, so temporary buffers can't be shared according to it.
+    use_inter_op_scheduler_ = p_engine_.get_kind() == dnnl::engine::kind::cpu
+            && graph::utils::getenv_int_internal("GRAPH_INTER_OP_PARALLEL", 0)
+                    > 0;
+    memory_planner_.set_memory_sharing(!use_inter_op_scheduler_);
+
     // get subgraph from the deep copied partition
     subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
             part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
@@ -303,10 +312,19 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
                         p_stream, res->get_exec_args()[i]);
             }
 
+            dnnl_constant_cache_dedup_and_regrant(
+                    p_engine_, p_stream, c_buffer, memory_planner_, *res);
+
             c_promise.set_value(c_buffer);
         }
     }
 
+    if (use_inter_op_scheduler_) {
+        inter_op_scheduler_t::execute(p_stream, subgraph_->execs_,
+                subgraph_->is_constant_, res->get_exec_args());
+        return status::success;
+    }
+
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
         if (subgraph_->is_constant_[i]) continue;
         subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
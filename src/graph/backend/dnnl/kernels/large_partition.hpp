@@ -50,6 +50,9 @@ protected:
 
     size_t const_md_hash_ = 0;
 
+    // Whether to execute the independent ops concurrently
+    bool use_inter_op_scheduler_ = false;
+
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
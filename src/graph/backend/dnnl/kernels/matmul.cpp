@@ -227,6 +227,9 @@ status_t matmul_t<quantized>::execute_impl(const stream_t *g_stream,
                         p_stream, res->get_exec_args()[i]);
             }
 
+            dnnl_constant_cache_dedup_and_regrant(
+                    p_engine_, p_stream, c_buffer, memory_planner_, *res);
+
             c_promise.set_value(c_buffer);
         }
     }
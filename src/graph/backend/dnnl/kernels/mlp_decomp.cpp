@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/mlp_decomp.hpp"
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+status_t mlp_decomp_kernel_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // Check if it's supported by decomposition kernel
+    if (!mlp_cfg_.initial_check(part->get_ops(), inputs, outputs))
+        return status::unimplemented;
+
+    // Initialize and construct kernel params
+    CHECK(mlp_cfg_.construct_params(p_engine_, part->get_fpmath_mode()));
+
+    // fill information for the output logical tensor: the dst is written
+    // as plain row-major [..., N]
+    auto &out = const_cast<logical_tensor_t &>(outputs[0]);
+    const auto &src = inputs[mlp_cfg_.graph_inport[0]];
+    out.ndims = src.ndims;
+    for (int d = 0; d < src.ndims; d++)
+        out.dims[d] = src.dims[d];
+    out.dims[out.ndims - 1] = mlp_cfg_.N;
+    out.layout_type = layout_type::strided;
+    dim_t stride = 1;
+    for (int d = out.ndims - 1; d >= 0; d--) {
+        out.layout.strides[d] = stride;
+        stride *= out.dims[d];
+    }
+
+    return status::success;
+}
+
+status_t mlp_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+    const auto &cfg = mlp_cfg_;
+    int nthr = cfg.nthr;
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+#endif
+
+    const auto &p0 = cfg.prims[0][0];
+    const size_t src_dt_size
+            = memory::data_type_size(p0.src_md.get_data_type());
+    const size_t dst_dt_size
+            = memory::data_type_size(cfg.dst_md[0].get_data_type());
+    const auto src = static_cast<const char *>(
+            inputs[cfg.graph_inport[0]].get_data_handle());
+    const auto wei_gate = static_cast<const char *>(
+            inputs[cfg.graph_inport[1]].get_data_handle());
+    const auto wei_up = static_cast<const char *>(
+            inputs[cfg.graph_inport[2]].get_data_handle());
+    const auto wei_down = static_cast<const char *>(
+            inputs[cfg.graph_inport[3]].get_data_handle());
+    const auto dst = static_cast<char *>(outputs[0].get_data_handle());
+
+    // allocate the per-thread internal memory
+    const size_t block_size = cfg.registry.size();
+    temporary_scratchpad_t scratchpad(block_size * nthr, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= block_size * nthr,
+            "no enough scratchpad memory");
+
+    // user pointers are only read through the memory objects
+    const auto as_handle
+            = [](const char *ptr) { return const_cast<char *>(ptr); };
+    const dim_t nb_M = impl::utils::div_up(cfg.M, cfg.M_blk);
+    const dim_t nb_I = impl::utils::div_up(cfg.I, cfg.I_blk);
+
+    parallel(nthr, [&](const int ithr, const int nthr_) {
+        dim_t start = 0, end = 0;
+        balance211(nb_M, nthr_, ithr, start, end);
+        if (start >= end) return;
+
+        const grantor_t grantor = cfg.registry.grantor(
+                scratchpad.get_buffer() + ithr * block_size);
+        char *up_ptr = grantor.get(mlp_decomp_config_t::key_up);
+        char *gate_ptr = grantor.get(mlp_decomp_config_t::key_gate);
+        char *acc_ptr = grantor.get(mlp_decomp_config_t::key_acc);
+        const bool with_scratchpad = !cfg.scratchpad_md.is_zero();
+        const memory scratchpad_mem = with_scratchpad
+                ? memory(cfg.scratchpad_md, p_engine_,
+                        grantor.get(mlp_decomp_config_t::key_scratchpad))
+                : memory();
+
+        const auto exec = [&](const primitive &prim,
+                                  std::unordered_map<int, memory> args) {
+            if (with_scratchpad)
+                args.insert({DNNL_ARG_SCRATCHPAD, scratchpad_mem});
+            prim.execute(strm, args);
+        };
+
+        for (dim_t mb = start; mb < end; mb++) {
+            const dim_t m = mb * cfg.M_blk;
+            const int mt = m + cfg.M_blk > cfg.M;
+            char *dst_ptr = dst + m * cfg.N * dst_dt_size;
+            const memory down_dst(cfg.prims[mt][0].down_dst_md, p_engine_,
+                    cfg.direct_dst ? dst_ptr : acc_ptr);
+            const memory src_mem(cfg.prims[mt][0].src_md, p_engine_,
+                    as_handle(src + m * cfg.K * src_dt_size));
+
+            for (dim_t ib = 0; ib < nb_I; ib++) {
+                const dim_t i = ib * cfg.I_blk;
+                const int it = i + cfg.I_blk > cfg.I;
+                const auto &p = cfg.prims[mt][it];
+                const memory wei_gate_mem(p.wei_gate_up_md, p_engine_,
+                        as_handle(wei_gate + i * src_dt_size));
+                const memory wei_up_mem(p.wei_gate_up_md, p_engine_,
+                        as_handle(wei_up + i * src_dt_size));
+                const memory wei_down_mem(p.wei_down_md, p_engine_,
+                        as_handle(wei_down + i * cfg.N * src_dt_size));
+                const memory up_mem(p.inter_md, p_engine_, up_ptr);
+                const memory inter_mem(p.inter_md, p_engine_, gate_ptr);
+
+                // in parallel region - these primitives use single thread.
+                const int up_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(
+                                           cfg.gate_bin_arg)
+                        | DNNL_ARG_SRC_1;
+                exec(p.up,
+                        {{DNNL_ARG_SRC, src_mem},
+                                {DNNL_ARG_WEIGHTS, wei_up_mem},
+                                {DNNL_ARG_DST, up_mem}});
+                exec(p.gate,
+                        {{DNNL_ARG_SRC, src_mem},
+                                {DNNL_ARG_WEIGHTS, wei_gate_mem},
+                                {DNNL_ARG_DST, inter_mem}, {up_arg, up_mem}});
+                // the first block initializes the down projection, the next
+                // ones accumulate into it
+                exec(ib == 0 ? p.down : p.down_acc,
+                        {{DNNL_ARG_SRC, inter_mem},
+                                {DNNL_ARG_WEIGHTS, wei_down_mem},
+                                {DNNL_ARG_DST, down_dst}});
+            }
+
+            if (!cfg.direct_dst) {
+                const memory dst_mem(cfg.dst_md[mt], p_engine_, dst_ptr);
+                exec(cfg.to_dst[mt],
+                        {{DNNL_ARG_FROM, down_dst}, {DNNL_ARG_TO, dst_mem}});
+            }
+        }
+    });
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,383 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/platform.hpp"
+#endif
+
+#include "graph/backend/dnnl/kernels/mlp_decomp_config.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+#define VCHECK_MLP_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, mlp_decomp_config, (cond), status, msg, \
+            ##__VA_ARGS__);
+
+namespace {
+
+using op_ptr = std::shared_ptr<op_t>;
+
+// Returns the producer of the input if it belongs to the partition.
+op_ptr get_producer(
+        const op_ptr &op, size_t offset, const std::vector<op_ptr> &ops) {
+    const auto val = op->get_input_value(offset);
+    if (!val->has_producer()) return nullptr;
+    const op_t *producer = &val->get_producer();
+    for (const auto &cur_op : ops)
+        if (cur_op.get() == producer) return cur_op;
+    return nullptr;
+}
+
+bool is_matmul(const op_ptr &op) {
+    return op && op->get_kind() == graph::op_kind::MatMul;
+}
+
+bool is_dense_row_major(const logical_tensor_t &lt) {
+    const logical_tensor_wrapper_t ltw(lt);
+    if (!ltw.is_strided()) return false;
+    const auto dims = ltw.vdims();
+    const auto strides = ltw.vstrides();
+    dim_t stride = 1;
+    for (int d = ltw.ndims() - 1; d >= 0; d--) {
+        if (dims[d] != 1 && strides[d] != stride) return false;
+        stride *= dims[d];
+    }
+    return true;
+}
+
+algorithm get_binary_alg(op_kind_t kind) {
+    switch (kind) {
+        case graph::op_kind::Add: return algorithm::binary_add;
+        case graph::op_kind::Multiply: return algorithm::binary_mul;
+        case graph::op_kind::Maximum: return algorithm::binary_max;
+        case graph::op_kind::Minimum: return algorithm::binary_min;
+        case graph::op_kind::Divide: return algorithm::binary_div;
+        case graph::op_kind::Subtract: return algorithm::binary_sub;
+        default: return algorithm::undef;
+    }
+}
+
+} // namespace
+
+bool mlp_decomp_config_t::initial_check(const std::vector<op_ptr> &ops,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_MLP_DECOMP(outputs.size() == 1, false,
+            "gated mlp should have a single output, but got %zu",
+            outputs.size());
+
+    // The down projection is the only matmul fed by another op of the
+    // partition.
+    op_ptr fc_down;
+    for (const auto &cur_op : ops) {
+        if (is_matmul(cur_op) && get_producer(cur_op, 0, ops)) {
+            fc_down = cur_op;
+            break;
+        }
+    }
+    VCHECK_MLP_DECOMP(fc_down != nullptr, false, "no down projection matmul");
+
+    const op_ptr bin = get_producer(fc_down, 0, ops);
+    bin_alg_ = get_binary_alg(bin->get_kind());
+    VCHECK_MLP_DECOMP(bin_alg_ != algorithm::undef, false,
+            "unsupported binary op %s",
+            op_t::kind2str(bin->get_kind()).c_str());
+
+    // The up projection feeds the binary op directly, the gate projection
+    // may go through an activation first.
+    const op_ptr bin_in[2]
+            = {get_producer(bin, 0, ops), get_producer(bin, 1, ops)};
+    VCHECK_MLP_DECOMP(bin_in[0] && bin_in[1], false,
+            "both inputs of the binary op should be computed in the "
+            "partition");
+    const int up_idx = is_matmul(bin_in[1]) ? 1 : 0;
+    const op_ptr fc_up = bin_in[up_idx];
+    const op_ptr act = bin_in[1 - up_idx];
+    VCHECK_MLP_DECOMP(is_matmul(fc_up), false, "no up projection matmul");
+    // The binary post-op of the gate matmul computes `act(gate) op up`.
+    VCHECK_MLP_DECOMP(up_idx == 1
+                    || impl::utils::one_of(bin_alg_, algorithm::binary_add,
+                            algorithm::binary_mul, algorithm::binary_max,
+                            algorithm::binary_min),
+            false, "non-commutative binary op with swapped inputs");
+
+    op_ptr fc_gate;
+    if (is_matmul(act)) {
+        fc_gate = act;
+    } else if (act->get_kind() == graph::op_kind::Multiply) {
+        // swish decomposed to sigmoid and multiply: gate * sigmoid(gate)
+        const op_ptr in0 = get_producer(act, 0, ops);
+        const op_ptr in1 = get_producer(act, 1, ops);
+        fc_gate = is_matmul(in0) ? in0 : in1;
+        const op_ptr sigmoid = is_matmul(in0) ? in1 : in0;
+        VCHECK_MLP_DECOMP(is_matmul(fc_gate) && sigmoid
+                        && sigmoid->get_kind() == graph::op_kind::Sigmoid
+                        && get_producer(sigmoid, 0, ops) == fc_gate,
+                false, "unsupported swish decomposition");
+        act_alg_ = algorithm::eltwise_swish;
+        act_alpha_ = 1.f;
+    } else {
+        VCHECK_MLP_DECOMP(get_eltwise_alg_map().count(act->get_kind()), false,
+                "unsupported activation %s",
+                op_t::kind2str(act->get_kind()).c_str());
+        fc_gate = get_producer(act, 0, ops);
+        VCHECK_MLP_DECOMP(
+                is_matmul(fc_gate), false, "no gate projection matmul");
+        act_alg_ = get_eltwise_alg(act, false);
+        auto eltwise = std::make_shared<op_t>(op_kind::dnnl_eltwise);
+        merge_common_eltwise_attrs(act, eltwise);
+        act_alpha_ = eltwise->get_attr<float>(op_attr::alpha);
+        act_beta_ = eltwise->get_attr<float>(op_attr::beta);
+    }
+    VCHECK_MLP_DECOMP(fc_gate != fc_up, false,
+            "gate and up projections should be different matmuls");
+
+    for (const auto &mm : {fc_gate, fc_up, fc_down}) {
+        VCHECK_MLP_DECOMP(
+                mm->num_inputs() == 2, false, "matmul bias is not supported");
+        const bool transpose_a = mm->has_attr(op_attr::transpose_a)
+                && mm->get_attr<bool>(op_attr::transpose_a);
+        const bool transpose_b = mm->has_attr(op_attr::transpose_b)
+                && mm->get_attr<bool>(op_attr::transpose_b);
+        VCHECK_MLP_DECOMP(!transpose_a && !transpose_b, false,
+                "transposed matmul inputs are not supported");
+    }
+    VCHECK_MLP_DECOMP(fc_gate->get_input_value(0)->get_logical_tensor().id
+                    == fc_up->get_input_value(0)->get_logical_tensor().id,
+            false, "gate and up projections should share the src");
+
+    // The order of input logical tensors in inputs is not certain, we need
+    // to record the input offset in a certain order of ops.
+    const auto find_graph_inport = [&](const op_ptr &op, size_t offset) {
+        const size_t id = op->get_input_value(offset)->get_logical_tensor().id;
+        for (int i = 0; i < (int)inputs.size(); i++) {
+            if (inputs[i].id == id) return i;
+        }
+        return -1;
+    };
+    graph_inport = {find_graph_inport(fc_gate, 0),
+            find_graph_inport(fc_gate, 1), find_graph_inport(fc_up, 1),
+            find_graph_inport(fc_down, 1)};
+    VCHECK_MLP_DECOMP(std::find(graph_inport.begin(), graph_inport.end(), -1)
+                    == graph_inport.end(),
+            false, "src and weights should be inputs of the partition");
+
+    const logical_tensor_wrapper_t src(inputs[graph_inport[0]]);
+    const logical_tensor_wrapper_t wei_gate(inputs[graph_inport[1]]);
+    const logical_tensor_wrapper_t wei_up(inputs[graph_inport[2]]);
+    const logical_tensor_wrapper_t wei_down(inputs[graph_inport[3]]);
+    const logical_tensor_wrapper_t dst(outputs[0]);
+    VCHECK_MLP_DECOMP(src.ndims() >= 2 && wei_gate.ndims() == 2
+                    && wei_up.ndims() == 2 && wei_down.ndims() == 2,
+            false, "src should be at least 2D and weights should be 2D");
+
+    const auto src_dims = src.vdims();
+    K = src_dims.back();
+    M = 1;
+    for (size_t d = 0; d + 1 < src_dims.size(); d++)
+        M *= src_dims[d];
+    I = wei_gate.vdims()[1];
+    N = wei_down.vdims()[1];
+    VCHECK_MLP_DECOMP(wei_gate.vdims() == wei_up.vdims()
+                    && wei_gate.vdims()[0] == K && wei_down.vdims()[0] == I,
+            false, "inconsistent gated mlp weights shapes");
+    if (!dst.is_shape_unknown()) {
+        auto dst_dims = src_dims;
+        dst_dims.back() = N;
+        VCHECK_MLP_DECOMP(dst.vdims() == dst_dims, false,
+                "unexpected gated mlp dst shape");
+    }
+
+    dt_src_ = static_cast<memory::data_type>(src.data_type());
+    dt_inter_ = static_cast<memory::data_type>(
+            logical_tensor_wrapper_t(
+                    fc_gate->get_output_value(0)->get_logical_tensor())
+                    .data_type());
+    dt_dst_ = static_cast<memory::data_type>(dst.data_type());
+    VCHECK_MLP_DECOMP(impl::utils::one_of(dt_src_, memory::data_type::f32,
+                              memory::data_type::bf16, memory::data_type::f16)
+                    && wei_gate.data_type() == src.data_type()
+                    && wei_up.data_type() == src.data_type()
+                    && wei_down.data_type() == src.data_type()
+                    && impl::utils::one_of(
+                            dt_dst_, dt_src_, memory::data_type::f32),
+            false, "unsupported gated mlp data types");
+
+    VCHECK_MLP_DECOMP(is_dense_row_major(inputs[graph_inport[0]])
+                    && is_dense_row_major(inputs[graph_inport[1]])
+                    && is_dense_row_major(inputs[graph_inport[2]])
+                    && is_dense_row_major(inputs[graph_inport[3]])
+                    && (dst.is_any() || is_dense_row_major(outputs[0])),
+            false, "only plain row-major tensors are supported");
+
+    // Every thread needs its own token blocks: small batches, e.g. token by
+    // token decoding, are better served by the matmuls parallel over N.
+    nthr = dnnl_get_current_num_threads();
+    const memory::dim min_rows_per_thr = 4;
+    VCHECK_MLP_DECOMP(nthr == 1 || M >= min_rows_per_thr * nthr, false,
+            "doesn't meet condition for decompose: M %ld, nthr %d",
+            static_cast<long int>(M), nthr);
+
+    M_blk = std::min<memory::dim>(32, impl::utils::div_up(M, nthr));
+
+    // The gate and up blocks should stay in L2 while the down projection
+    // consumes them.
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const size_t l2_size = cpu::platform::get_per_core_cache_size(2);
+#else
+    const size_t l2_size = 1024 * 1024;
+#endif
+    const size_t col_size = 2 * M_blk * memory::data_type_size(dt_inter_);
+    const memory::dim I_blk_max = static_cast<memory::dim>(
+            impl::utils::rnd_dn(l2_size / 2 / col_size, 64));
+    I_blk = std::min(I, std::max<memory::dim>(64, I_blk_max));
+
+    return true;
+}
+
+status_t mlp_decomp_config_t::construct_params(
+        const dnnl::engine &p_engine, const graph::fpmath_t &fpmath) {
+    using dims = memory::dims;
+    using tag = memory::format_tag;
+
+    direct_dst = dt_dst_ == memory::data_type::f32;
+
+    // must use user mode to support concurrent execution
+    primitive_attr base_attr;
+    base_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    primitive_attr reorder_attr = base_attr;
+    base_attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    post_ops gate_pops;
+    if (act_alg_ != algorithm::undef)
+        gate_pops.append_eltwise(act_alg_, act_alpha_, act_beta_);
+    gate_bin_arg = gate_pops.len();
+
+    size_t max_scratchpad_size = 0;
+    const auto update_scratchpad = [&](const primitive_desc_base &pd) {
+        max_scratchpad_size = std::max(
+                max_scratchpad_size, pd.scratchpad_desc().get_size());
+    };
+
+    const memory::dim m_sizes[2] = {M_blk, M % M_blk};
+    const memory::dim i_sizes[2] = {I_blk, I % I_blk};
+    const auto create_prims = [&]() {
+        for (int mt = 0; mt < 2; mt++) {
+            const memory::dim mb = m_sizes[mt];
+            if (mb == 0) continue;
+            acc_md[mt] = memory::desc(
+                    {mb, N}, memory::data_type::f32, dims {N, 1});
+            dst_md[mt] = memory::desc({mb, N}, dt_dst_, dims {N, 1});
+            if (!direct_dst) {
+                auto to_dst_pd = reorder::primitive_desc(p_engine, acc_md[mt],
+                        p_engine, dst_md[mt], reorder_attr);
+                update_scratchpad(to_dst_pd);
+                to_dst[mt] = reorder(to_dst_pd);
+            }
+
+            for (int it = 0; it < 2; it++) {
+                const memory::dim ib = i_sizes[it];
+                if (ib == 0) continue;
+                auto &p = prims[mt][it];
+                p.src_md = memory::desc({mb, K}, dt_src_, dims {K, 1});
+                p.wei_gate_up_md = memory::desc({K, ib}, dt_src_, dims {I, 1});
+                p.inter_md = memory::desc({mb, ib}, dt_inter_, tag::ab);
+                p.wei_down_md = memory::desc({ib, N}, dt_src_, dims {N, 1});
+                p.down_dst_md = direct_dst ? dst_md[mt] : acc_md[mt];
+
+                auto up_pd = matmul::primitive_desc(p_engine, p.src_md,
+                        p.wei_gate_up_md, p.inter_md, base_attr);
+
+                post_ops pops = gate_pops;
+                pops.append_binary(bin_alg_, p.inter_md);
+                primitive_attr gate_attr = base_attr;
+                gate_attr.set_post_ops(pops);
+                auto gate_pd = matmul::primitive_desc(p_engine, p.src_md,
+                        p.wei_gate_up_md, p.inter_md, gate_attr);
+
+                auto down_pd = matmul::primitive_desc(p_engine, p.inter_md,
+                        p.wei_down_md, p.down_dst_md, base_attr);
+
+                post_ops acc_pops;
+                acc_pops.append_sum(1.f);
+                primitive_attr acc_attr = base_attr;
+                acc_attr.set_post_ops(acc_pops);
+                auto down_acc_pd = matmul::primitive_desc(p_engine, p.inter_md,
+                        p.wei_down_md, p.down_dst_md, acc_attr);
+
+                for (const auto &pd : {up_pd, gate_pd, down_pd, down_acc_pd})
+                    update_scratchpad(pd);
+                p.up = matmul(up_pd);
+                p.gate = matmul(gate_pd);
+                p.down = matmul(down_pd);
+                p.down_acc = matmul(down_acc_pd);
+            }
+        }
+    };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // The primitives run inside of the parallel region of the kernel, so
+    // they are created for a single thread.
+    const int saved_nthr = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    status_t status = status::success;
+    try {
+        create_prims();
+    } catch (const dnnl::error &e) {
+        status = static_cast<status_t>(e.status);
+    }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(saved_nthr);
+#endif
+    VCHECK_MLP_DECOMP(status == status::success, status,
+            "failed to create gated mlp primitives");
+
+    if (max_scratchpad_size > 0)
+        scratchpad_md = memory::desc(
+                {static_cast<memory::dim>(max_scratchpad_size)},
+                memory::data_type::u8, tag::a);
+
+    // Per-thread buffers: the up and gate blocks of the intermediate tensor,
+    // the f32 accumulator of the down projection and the scratchpad shared
+    // by all the primitives.
+    registry.clear();
+    registrar_t registrar = registry.registrar();
+    const size_t inter_size = memory::desc({M_blk, I_blk}, dt_inter_, tag::ab)
+                                      .get_size();
+    registrar.book(key_up, inter_size);
+    registrar.book(key_gate, inter_size);
+    if (!direct_dst) registrar.book(key_acc, acc_md[0].get_size());
+    if (max_scratchpad_size > 0)
+        registrar.book(key_scratchpad, max_scratchpad_size);
+
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
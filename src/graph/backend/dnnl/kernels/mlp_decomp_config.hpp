@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_MLP_DECOMP_CONFIG_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_MLP_DECOMP_CONFIG_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/graph_attr.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/op.hpp"
+
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Gated MLP computed block by block:
+//     inter[M, I] = act(src[M, K] x wei_gate[K, I]) op (src x wei_up[K, I])
+//     dst[M, N] = inter x wei_down[I, N]
+// Each thread owns a block of M_blk tokens and walks the intermediate
+// dimension by I_blk columns: the gate and up slices are computed together,
+// the activation and the binary op are applied as post-ops of the gate
+// matmul and the result is immediately accumulated into the down
+// projection. The [M, I] intermediate tensor is never materialized.
+struct mlp_decomp_config_t {
+public:
+    mlp_decomp_config_t() = default;
+
+    memory::dim M = 0, K = 0, I = 0, N = 0;
+    memory::dim M_blk = 0, I_blk = 0;
+
+    // Thread nums during the workflow
+    int nthr = 1;
+
+    // Used to record the exact input offset of the MLP subgraph
+    // [src, wei_gate, wei_up, wei_down]
+    std::vector<int> graph_inport;
+
+    // Primitives for one block, indexed by [is_m_tail][is_i_tail]
+    struct blk_prims_t {
+        primitive up, gate, down, down_acc;
+        memory::desc src_md, wei_gate_up_md, inter_md, wei_down_md,
+                down_dst_md;
+    };
+    blk_prims_t prims[2][2];
+    // converts the f32 accumulator to the user dst, indexed by [is_m_tail]
+    primitive to_dst[2];
+    memory::desc acc_md[2], dst_md[2];
+    // shared by all the primitives of a thread, empty if none needs it
+    memory::desc scratchpad_md;
+
+    // The down projection accumulates directly in the user dst if it is f32
+    bool direct_dst = false;
+    // The arg index of the binary post-op of the gate matmul
+    int gate_bin_arg = 0;
+
+    // Per-thread buffers booked in the registry
+    enum { key_up = 0, key_gate, key_acc, key_scratchpad };
+    registry_t registry;
+
+    // The function is used to check if the configuration of the gated MLP is
+    // supported by the decomposition kernel: plain row-major tensors, 2D
+    // weights, no bias or transposes, and enough tokens to give every thread
+    // its own blocks. Otherwise the large partition kernel is used.
+    bool initial_check(const std::vector<std::shared_ptr<op_t>> &ops,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+
+    // Used to construct all the primitives and the per-thread buffers
+    status_t construct_params(
+            const dnnl::engine &p_engine, const graph::fpmath_t &fpmath);
+
+private:
+    memory::data_type dt_src_ = memory::data_type::undef,
+                      dt_inter_ = memory::data_type::undef,
+                      dt_dst_ = memory::data_type::undef;
+
+    algorithm act_alg_ = algorithm::undef;
+    float act_alpha_ = 0.f, act_beta_ = 0.f;
+    algorithm bin_alg_ = algorithm::undef;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
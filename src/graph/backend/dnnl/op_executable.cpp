@@ -49,6 +49,16 @@ namespace dnnl_impl {
 const indices_t::type_t input = indices_t::type_t::input;
 const indices_t::type_t output = indices_t::type_t::output;
 
+// brgemm based convolution and matmul implementations read a plain src
+// through their copy routines. When such an implementation accepts the plain
+// src given by the producer, the reorder to the layout queried with format
+// any can be dropped.
+static bool is_brgemm_impl(const dnnl::primitive_desc_base &pd) {
+    return pd
+            && std::string(pd.impl_info_str()).find("brg")
+            != std::string::npos;
+}
+
 conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -83,6 +93,7 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
 
     auto src = make_dnnl_memory_desc(
             op->get_input_value(0)->get_logical_tensor());
+    const auto given_src = src;
 
     // assume constant weight is for inference scenario
     const auto &wei_lt = op->get_input_value(1)->get_logical_tensor();
@@ -105,7 +116,8 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
     }
     auto dst = make_dnnl_memory_desc(base_conv_dst_lt);
     auto create_pd = [&](const dnnl::memory::desc &src_md,
-                             const dnnl::memory::desc &dst_md) {
+                             const dnnl::memory::desc &dst_md,
+                             bool allow_empty = false) {
         if (op->has_attr(op_attr::with_bias)
                 && op->get_attr<bool>(op_attr::with_bias)) {
             auto bias = make_dnnl_memory_desc(
@@ -113,15 +125,22 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
             bias = to_format_any(bias);
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, bias, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         } else {
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         }
     };
 
-    if (!can_use_blocked_layout) {
+    // The layout selection pass may ask for plain activations when the
+    // reorders around a blocked kernel are estimated to cost more than the
+    // kernel gains from them.
+    const bool prefer_plain_layout = op->has_attr(op_attr::prefer_plain_layout)
+            && op->get_attr<bool>(op_attr::prefer_plain_layout);
+    if (!can_use_blocked_layout || prefer_plain_layout) {
         src = to_nxc_format(src);
         dst = to_nxc_format(dst);
     } else {
@@ -161,6 +180,11 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
     }
 
     dnnl::convolution_forward::primitive_desc pd = create_pd(src, dst);
+    if (can_use_blocked_layout && !is_plain(pd.src_desc())
+            && is_format(given_src, "nxc")) {
+        auto plain_src_pd = create_pd(given_src, dst, /* allow_empty */ true);
+        if (is_brgemm_impl(plain_src_pd)) pd = plain_src_pd;
+    }
 
     pd_cache.insert({op.get(), pd});
 
@@ -356,6 +380,7 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
 
     auto src = make_dnnl_memory_desc(
             op->get_input_value(0)->get_logical_tensor());
+    const auto given_src = src;
     // For non-constant activation, create primitive desc with strided layout
     // when:
     // 1) activation has 4 dimensions and layout is acbd since oneDNN has
@@ -378,8 +403,15 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
     // convert src memory desc to any when:
     // 1) not the situation mentioned above
     // 2) the given md is blocked and convert to queried layout is necessary
+    // If the layout selection pass asked for plain activations, the given md is
+    // used as-is when plain and converted to plain otherwise.
+    const bool prefer_plain_layout = op->has_attr(op_attr::prefer_plain_layout)
+            && op->get_attr<bool>(op_attr::prefer_plain_layout);
     if (can_use_blocked_layout && (!use_strided_src || !is_plain(src))) {
-        src = to_format_any(src);
+        if (!prefer_plain_layout)
+            src = to_format_any(src);
+        else if (!is_plain(src))
+            src = to_ncx_format(src);
     }
     auto wei = make_dnnl_memory_desc(
             op->get_input_value(1)->get_logical_tensor());
@@ -404,7 +436,7 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
     const bool use_strided_dst
             = ((src.get_ndims() == 2 || src.get_ndims() == 3)
                       && p_engine.get_kind() == dnnl::engine::kind::gpu)
-            || keep_dst_layout;
+            || keep_dst_layout || prefer_plain_layout;
     if (can_use_blocked_layout && !use_strided_dst) {
         dst = to_format_any(dst);
     } else if (dst.get_format_kind() == dnnl::memory::format_kind::any
@@ -418,16 +450,26 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
         // do nothing
     }
 
-    dnnl::matmul::primitive_desc pd;
-    if (op->has_attr(op_attr::with_bias)
-            && op->get_attr<bool>(op_attr::with_bias)) {
-        auto bias = make_dnnl_memory_desc(
-                op->get_input_value(2)->get_logical_tensor());
-        bias = to_format_any(bias);
-        pd = dnnl::matmul::primitive_desc(
-                p_engine, src, wei, bias, dst, prm_attr);
-    } else {
-        pd = dnnl::matmul::primitive_desc(p_engine, src, wei, dst, prm_attr);
+    auto create_pd = [&](const dnnl::memory::desc &src_md,
+                             bool allow_empty = false) {
+        if (op->has_attr(op_attr::with_bias)
+                && op->get_attr<bool>(op_attr::with_bias)) {
+            auto bias = make_dnnl_memory_desc(
+                    op->get_input_value(2)->get_logical_tensor());
+            bias = to_format_any(bias);
+            return dnnl::matmul::primitive_desc(
+                    p_engine, src_md, wei, bias, dst, prm_attr, allow_empty);
+        } else {
+            return dnnl::matmul::primitive_desc(
+                    p_engine, src_md, wei, dst, prm_attr, allow_empty);
+        }
+    };
+
+    dnnl::matmul::primitive_desc pd = create_pd(src);
+    if (can_use_blocked_layout && !const_activation && is_plain(given_src)
+            && pd.src_desc() != given_src) {
+        auto given_src_pd = create_pd(given_src, /* allow_empty */ true);
+        if (is_brgemm_impl(given_src_pd)) pd = given_src_pd;
     }
 
     pd_cache.insert({op.get(), pd});
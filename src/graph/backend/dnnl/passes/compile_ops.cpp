@@ -21,6 +21,7 @@
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
+#include "graph/backend/dnnl/exec_tracer.hpp"
 #include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -72,6 +73,7 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
                     "failed to create executable for op %s",
                     op->get_name().c_str());
         }
+        if (exec_trace_enabled()) exec = make_traced_executable(exec, *op);
         sg->execs_.emplace_back(exec);
 
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
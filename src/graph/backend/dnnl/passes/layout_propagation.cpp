@@ -14,8 +14,11 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "oneapi/dnnl/dnnl.hpp"
@@ -84,6 +87,179 @@ void force_partition_output_plain_layout(std::shared_ptr<subgraph_t> &sg) {
     rewriter.run();
 }
 
+namespace {
+
+// Costs of the layout selection are measured in flop-equivalents. A reorder
+// reads and writes every byte of a tensor and moving one byte is assumed to be
+// as expensive as `reorder_flops_per_byte` flops of a compute bound kernel.
+// Running a convolution or matmul on plain activations instead of the layout
+// queried with *any* is assumed to be `plain_layout_penalty` slower.
+constexpr double reorder_flops_per_byte = 16.0;
+constexpr double plain_layout_penalty = 0.1;
+
+bool is_layout_selectable(const op_t *op) {
+    return op->get_kind() == op_kind::dnnl_convolution
+            || op->get_kind() == op_kind::dnnl_matmul;
+}
+
+// Returns the number of flops of a convolution or matmul, or a negative value
+// if the shapes are not known at compilation time.
+double estimate_flops(const op_t *op) {
+    const ltw src(op->get_input_value(0)->get_logical_tensor());
+    const ltw wei(op->get_input_value(1)->get_logical_tensor());
+    const ltw dst(op->get_output_value(0)->get_logical_tensor());
+    if (src.nelems() <= 0 || wei.nelems() <= 0 || dst.nelems() <= 0)
+        return -1.0;
+
+    const auto dst_dims = dst.vdims();
+    if (op->get_kind() == op_kind::dnnl_convolution) {
+        const bool is_ncx = !op->has_attr(op_attr::data_format)
+                || op->get_attr<std::string>(op_attr::data_format) == "NCX";
+        const dim_t oc = is_ncx ? dst_dims[1] : dst_dims.back();
+        return 2.0 * dst.nelems() * wei.nelems() / oc;
+    }
+
+    const auto src_dims = src.vdims();
+    const bool transpose_a = op->has_attr(op_attr::transpose_a)
+            && op->get_attr<bool>(op_attr::transpose_a);
+    const dim_t k = (transpose_a && src_dims.size() > 1)
+            ? src_dims[src_dims.size() - 2]
+            : src_dims.back();
+    return 2.0 * dst.nelems() * k;
+}
+
+double estimate_reorder_cost(const logical_tensor_t &lt) {
+    const ltw w(lt);
+    return 2.0 * reorder_flops_per_byte * w.nelems() * w.data_type_size();
+}
+
+// Checks if a strided tensor already has the plain layout the op uses when
+// prefer_plain_layout is set: nxc for convolution and any dense plain layout
+// for matmul.
+bool has_plain_layout_of(const op_t *op, const logical_tensor_t &lt) {
+    if (!ltw(lt).is_strided() || ltw(lt).is_stride_unknown()) return false;
+    const auto md = make_dnnl_memory_desc(lt);
+    return op->get_kind() == op_kind::dnnl_convolution ? is_format(md, "nxc")
+                                                       : is_plain(md);
+}
+
+// Returns the next op of a chain: the only consumer of the op's output if it
+// is a selectable op of the same kind taking the output as its activation.
+op_t *get_chain_next(const op_t *op) {
+    const auto &consumers = op->get_output_value(0)->get_consumers();
+    if (consumers.size() != 1 || consumers[0].get_offset() != 0)
+        return nullptr;
+    op_t *next = &consumers[0].get_op();
+    if (next->get_kind() != op->get_kind()) return nullptr;
+    return next;
+}
+
+// Chooses between the plain and the queried blocked activation layout for
+// chains of convolutions or matmuls connected through their activations. For
+// each chain a dynamic programming over the ops finds the assignment of
+// layouts which minimizes the estimated kernel time plus the time of the
+// reorders needed between ops and at the chain boundaries which are fixed to a
+// plain layout by the user. Ops for which plain is chosen are marked with
+// prefer_plain_layout so that their primitive descriptors are created with
+// plain activations.
+void select_activation_layouts(std::shared_ptr<subgraph_t> &sg) {
+    enum { plain = 0, blocked = 1, nstates = 2 };
+
+    std::unordered_set<op_t *> visited;
+    for (auto &cur_op : sg->get_ops()) {
+        op_t *head = cur_op.get();
+        if (!is_layout_selectable(head) || visited.count(head)) continue;
+
+        // only start from the head of a chain
+        const auto &src_val = head->get_input_value(0);
+        if (src_val->has_producer()) {
+            const op_t &prod = src_val->get_producer();
+            if (is_layout_selectable(&prod) && get_chain_next(&prod) == head)
+                continue;
+        }
+
+        std::vector<op_t *> chain;
+        for (op_t *op = head; op && !visited.count(op);
+                op = get_chain_next(op)) {
+            chain.push_back(op);
+            visited.insert(op);
+        }
+
+        std::vector<double> flops(chain.size());
+        bool known = true;
+        for (size_t i = 0; i < chain.size(); ++i) {
+            flops[i] = estimate_flops(chain[i]);
+            known = known && flops[i] >= 0;
+        }
+        if (!known) continue;
+
+        const op_t *tail = chain.back();
+        const auto &head_src_lt = src_val->get_logical_tensor();
+        const auto &tail_dst_lt
+                = tail->get_output_value(0)->get_logical_tensor();
+        // a blocked layout at a boundary given in plain layout needs a reorder
+        const double head_cost = has_plain_layout_of(head, head_src_lt)
+                ? estimate_reorder_cost(head_src_lt)
+                : 0.0;
+        const double tail_cost
+                = tail->get_output_value(0)->get_consumers().empty()
+                        && has_plain_layout_of(tail, tail_dst_lt)
+                ? estimate_reorder_cost(tail_dst_lt)
+                : 0.0;
+
+        // cost[i][s] is the minimal cost of ops 0..i with op i in state s,
+        // from[i][s] is the state of op i - 1 this cost was reached from.
+        std::vector<std::array<double, nstates>> cost(chain.size());
+        std::vector<std::array<int, nstates>> from(chain.size());
+        for (size_t i = 0; i < chain.size(); ++i) {
+            const double op_cost[nstates]
+                    = {flops[i] * (1.0 + plain_layout_penalty), flops[i]};
+            for (int s = 0; s < nstates; ++s) {
+                if (i == 0) {
+                    cost[i][s] = op_cost[s] + (s == blocked ? head_cost : 0.0);
+                    from[i][s] = -1;
+                    continue;
+                }
+                const double link_cost = estimate_reorder_cost(
+                        chain[i]->get_input_value(0)->get_logical_tensor());
+                const double stay = cost[i - 1][s];
+                const double flip = cost[i - 1][1 - s] + link_cost;
+                cost[i][s] = op_cost[s] + std::min(stay, flip);
+                from[i][s] = stay <= flip ? s : 1 - s;
+            }
+        }
+
+        const size_t last = chain.size() - 1;
+        const double total[nstates]
+                = {cost[last][plain], cost[last][blocked] + tail_cost};
+        int state = total[plain] < total[blocked] ? plain : blocked;
+
+        size_t num_plain = 0;
+        for (size_t i = chain.size(); i-- > 0;) {
+            if (state == plain) {
+                chain[i]->set_attr<bool>(op_attr::prefer_plain_layout, true);
+                num_plain++;
+            }
+            state = from[i][state];
+        }
+
+        VINFO(graph, create, dispatch, layout_propagation,
+                "chain of %zu ops starting at %s: %zu plain, estimated cost "
+                "%g flops",
+                chain.size(), head->get_name().c_str(), num_plain,
+                std::min(total[plain], total[blocked]));
+    }
+}
+
+size_t count_reorders(const std::shared_ptr<subgraph_t> &sg) {
+    size_t num = 0;
+    for (const auto &op : sg->get_ops())
+        num += op->get_kind() == op_kind::dnnl_reorder;
+    return num;
+}
+
+} // namespace
+
 /// This function is used to chooses optimal layout for computation bound op and
 /// propagate the chosen optimal layout and given in/outputs layout in the
 /// subgraph.
@@ -107,6 +283,11 @@ status_t layout_propagation(std::shared_ptr<subgraph_t> &sg) {
     auto &mgr = sg->fusion_info_mgr_;
     auto &pd_cache = sg->pd_cache_;
 
+    if (mgr.get_use_blocked_layout()
+            && p_engine.get_kind() == dnnl::engine::kind::cpu)
+        select_activation_layouts(sg);
+    const size_t num_reorders = count_reorders(sg);
+
     status_t ret;
     std::unordered_set<op_t *> visited;
     int propagation_number = 0;
@@ -157,6 +338,9 @@ status_t layout_propagation(std::shared_ptr<subgraph_t> &sg) {
     // performance.
     if (!mgr.get_use_blocked_layout()) force_partition_output_plain_layout(sg);
 
+    VINFO(graph, create, dispatch, layout_propagation, "reorders inserted: %zu",
+            count_reorders(sg) - num_reorders);
+
     // fill layout information for subgraph's inputs
     for (size_t i = 0; i < sg->ins_.size(); i++) {
         for (auto in_val : sg->get_input_values()) {
@@ -882,8 +882,8 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     // By default, memory reuse is enabled. We can use this internal env
     // var to disable it. The env var is for debugging purpose only and may
     // be removed without any prior notice.
-    bool enable_memory_sharing
-            = graph::utils::getenv_int_internal("ENABLE_MEM_REUSE", 1) > 0;
+    bool enable_memory_sharing = enable_memory_sharing_
+            && graph::utils::getenv_int_internal("ENABLE_MEM_REUSE", 1) > 0;
     if (!enable_memory_sharing) {
         // if not enable memory sharing, we add additional 1 to edge reference
         // count, so that tensors will not be reused
@@ -331,6 +331,8 @@ private:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
 //     - 1 (default): Enable memory sharing
+//   The sharing is also disabled if the kernel requires it by calling
+//   set_memory_sharing(false).
 class memory_planner_t {
 public:
     memory_planner_t()
@@ -353,6 +355,10 @@ public:
         return persistent_registry_.size();
     }
 
+    size_t internal_persistent_alignment() const {
+        return persistent_registry_.lcm_alignment();
+    }
+
     size_t total_internal_temporary_size() const {
         return temporary_registry_.size();
     }
@@ -361,6 +367,11 @@ public:
 
     status_t run(std::shared_ptr<subgraph_t> &sg);
 
+    // Temporary buffers are shared according to the live ranges computed from
+    // the topological order. Kernels which don't execute the ops in that order
+    // (eg. the inter-op scheduler) must disable the sharing.
+    void set_memory_sharing(bool enable) { enable_memory_sharing_ = enable; }
+
     const std::vector<inplace_pair_t> &get_subgraph_inplace_pairs() const {
         return inplace_pairs_;
     };
@@ -467,6 +478,8 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+
+    bool enable_memory_sharing_ = true;
 };
 
 } // namespace dnnl_impl
@@ -72,6 +72,14 @@ static bool is_output_scales_supported(op_kind_t kind) {
     return ops.count(kind) == 0;
 }
 
+static size_t count_reorders(const std::shared_ptr<subgraph_t> &sg) {
+    size_t num = 0;
+    for (const auto &op : sg->get_ops())
+        num += op->get_kind() == op_kind::dnnl_reorder
+                || op->get_kind() == graph::op_kind::Reorder;
+    return num;
+}
+
 status_t check_with_bias(std::shared_ptr<subgraph_t> &sg) {
     for (auto &cur_op : sg->get_ops()) {
         if (!has_optional_bias(cur_op->get_kind())) continue;
@@ -2768,6 +2776,7 @@ status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg) {
 
     int cnt = 0;
     const int max_num_limit = static_cast<int>(sg->num_ops());
+    const size_t num_reorders = count_reorders(sg);
 
     bool changed = true;
     do {
@@ -2777,6 +2786,9 @@ status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg) {
 
     VCHECK_TRANSFORM(cnt <= max_num_limit + 1, status::unimplemented,
             "Reorder fusion failed.");
+    VINFO(graph, create, dispatch, transform,
+            "adjacent reorders eliminated: %zu",
+            num_reorders - count_reorders(sg));
 
     return status::success;
 }
@@ -3294,6 +3306,7 @@ status_t common_reorder_elimination(std::shared_ptr<subgraph_t> &sg) {
 
     int cnt = 0;
     const int max_iter_num = static_cast<int>(sg->num_ops());
+    const size_t num_reorders = count_reorders(sg);
 
     bool changed = true;
     do {
@@ -3304,6 +3317,9 @@ status_t common_reorder_elimination(std::shared_ptr<subgraph_t> &sg) {
     VCHECK_TRANSFORM(cnt <= max_iter_num + 1, status::unimplemented,
             "Failed to eliminate common reorders since the pass can't "
             "converge.");
+    VINFO(graph, create, dispatch, transform,
+            "common reorders eliminated: %zu",
+            num_reorders - count_reorders(sg));
 
     return status::success;
 }
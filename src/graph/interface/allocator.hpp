@@ -125,6 +125,13 @@ public:
         if (buffer) { host_free_(buffer); }
     }
 
+    // Returns true if host buffers are managed by the library.
+    bool is_default_host_allocator() const {
+        using dnnl::impl::graph::utils::cpu_allocator_t;
+        return host_malloc_ == cpu_allocator_t::malloc
+                && host_free_ == cpu_allocator_t::free;
+    }
+
 #ifdef DNNL_WITH_SYCL
     void deallocate(void *buffer, const ::sycl::device &dev,
             const ::sycl::context &ctx, ::sycl::event deps) const {
@@ -15,10 +15,14 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "common/engine.hpp"
 #include "common/utils.hpp"
@@ -41,6 +45,11 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 namespace std {
@@ -60,6 +69,7 @@ namespace graph {
 
 using c_key_t = constant_tensor_cache_t::key_t;
 using c_value_t = constant_tensor_cache_t::value_t;
+using c_cached_t = constant_tensor_cache_t::cached_t;
 
 static size_t get_timestamp() {
     return std::chrono::steady_clock::now().time_since_epoch().count();
@@ -67,7 +77,14 @@ static size_t get_timestamp() {
 
 constant_tensor_cache_t::constant_tensor_cache_t(
         size_t capacity_in_bytes, const std::string &name)
-    : name_(name), capacity_in_bytes_(capacity_in_bytes), counter_(1) {
+    : name_(name)
+    , capacity_in_bytes_(capacity_in_bytes)
+    , counter_(1)
+    , dedup_enabled_(impl::getenv_int_user(
+                             "GRAPH_CONSTANT_TENSOR_CACHE_DEDUP", 0)
+              > 0)
+    , shared_store_dir_(impl::getenv_string_user(
+              "GRAPH_CONSTANT_TENSOR_CACHE_SHARED_STORE")) {
     constant_map_ = impl::utils::make_unique<
             std::unordered_map<c_key_t, timed_entry_t>>();
 }
@@ -220,15 +237,158 @@ void constant_tensor_cache_t::remove_if_exist(
     }
 }
 
-// Get the total size of all cached buffers
+// Get the total size of all cached buffers. A buffer shared by several
+// entries after deduplication is only counted once.
 size_t constant_tensor_cache_t::get_size() const {
     size_t total_size = 0;
+    std::unordered_set<const void *> counted;
     for (const auto &pair : constant_map()) {
-        total_size += pair.second.value_.get()->size();
+        const auto &buffer = pair.second.value_.get();
+        if (!counted.insert(buffer->data<void>()).second) continue;
+        total_size += buffer->size();
     }
     return total_size;
 }
 
+void constant_tensor_cache_t::set_dedup(
+        bool enable, const std::string &shared_store_dir) {
+    std::lock_guard<std::mutex> lock(content_mutex_);
+    dedup_enabled_ = enable;
+    shared_store_dir_ = shared_store_dir;
+}
+
+static size_t hash_content(const void *data, size_t size) {
+    const char *ptr = static_cast<const char *>(data);
+    size_t seed = size;
+    size_t off = 0;
+    for (; off + sizeof(uint64_t) <= size; off += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, ptr + off, sizeof(uint64_t));
+        seed = hash_combine(seed, word);
+    }
+    for (; off < size; off++)
+        seed = hash_combine(seed, ptr[off]);
+    return seed;
+}
+
+#ifndef _WIN32
+namespace {
+// A constant buffer backed by a read-only mapping of a file in the shared
+// store directory
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    mapped_constant_buffer_t(void *data, size_t size, impl::engine_t *eng)
+        : constant_buffer_t(data, size, eng, nullptr, free_func) {}
+
+    ~mapped_constant_buffer_t() override { munmap(data_, size_); }
+
+private:
+    static void free_func(void *, impl::engine_t *, allocator_t *) {}
+};
+
+bool write_file(const std::string &path, const char *data, size_t size) {
+    const int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0600);
+    if (fd < 0) return false;
+    size_t written = 0;
+    while (written < size) {
+        const ssize_t ret = write(fd, data + written, size - written);
+        if (ret < 0 && errno == EINTR) continue;
+        if (ret <= 0) break;
+        written += static_cast<size_t>(ret);
+    }
+    close(fd);
+    if (written == size) return true;
+    unlink(path.c_str());
+    return false;
+}
+} // namespace
+#endif
+
+constant_tensor_cache_t::cached_t constant_tensor_cache_t::map_shared_buffer(
+        const cached_t &buffer, size_t hash) const {
+#ifndef _WIN32
+    const size_t size = buffer->size();
+    char name[64];
+    snprintf(name, sizeof(name), "/onednn_graph_constant_%016zx_%zu", hash,
+            size);
+    const std::string path = shared_store_dir_ + name;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        // Publish the content under a temporary name first, so that other
+        // processes never map a partially written file.
+        static std::atomic<size_t> tmp_id(0);
+        const std::string tmp_path = path + ".tmp."
+                + std::to_string(getpid()) + "." + std::to_string(tmp_id++);
+        if (!write_file(tmp_path, buffer->data<char>(), size)) return nullptr;
+        if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+            unlink(tmp_path.c_str());
+            return nullptr;
+        }
+        fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return nullptr;
+    }
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size)
+        data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return nullptr;
+
+    // Protect against hash collisions and corrupted files
+    if (std::memcmp(data, buffer->data<void>(), size) != 0) {
+        munmap(data, size);
+        return nullptr;
+    }
+    return std::make_shared<mapped_constant_buffer_t>(
+            data, size, buffer->get_engine());
+#else
+    UNUSED(buffer);
+    UNUSED(hash);
+    return nullptr;
+#endif
+}
+
+c_cached_t constant_tensor_cache_t::dedup(
+        const c_cached_t &buffer, size_t alignment) {
+    if (!buffer || buffer->size() == 0 || alignment == 0) return buffer;
+
+    // The content is placed relatively to the first aligned address in the
+    // buffer, so only buffers with the same misalignment are interchangeable.
+    const auto misalignment = [&](const c_cached_t &b) {
+        return reinterpret_cast<uintptr_t>(b->data<void>()) % alignment;
+    };
+
+    const size_t hash = hash_content(buffer->data<void>(), buffer->size());
+
+    std::lock_guard<std::mutex> lock(content_mutex_);
+    auto range = content_map_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+        c_cached_t cached = it->second.lock();
+        if (!cached) {
+            it = content_map_.erase(it);
+            continue;
+        }
+        if (cached->size() == buffer->size()
+                && misalignment(cached) == misalignment(buffer)
+                && std::memcmp(cached->data<void>(), buffer->data<void>(),
+                           buffer->size())
+                        == 0)
+            return cached;
+        ++it;
+    }
+
+    c_cached_t ret = buffer;
+    if (!shared_store_dir_.empty()) {
+        c_cached_t mapped = map_shared_buffer(buffer, hash);
+        if (mapped && misalignment(mapped) == misalignment(buffer))
+            ret = mapped;
+    }
+    content_map_.emplace(hash, ret);
+    return ret;
+}
+
 void constant_tensor_cache_t::add(
         const c_key_t &key, size_t size, const c_value_t &constant) {
     size_t current_size = get_size();
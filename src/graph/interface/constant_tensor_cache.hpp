@@ -21,6 +21,8 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 
@@ -70,11 +72,26 @@ public:
 
     size_t size() const { return size_; }
 
+    impl::engine_t *get_engine() const { return eng_; }
+
     // used to notify backend the buffer has been evict. backend can use this
     // api to avoid query constant cache frequently to reduce overhead.
     virtual void notify_evict() {}
 
 protected:
+    // Wraps a memory which is not allocated by the malloc function handle.
+    // The free function handle is still called on destruction.
+    constant_buffer_t(void *data, size_t size, impl::engine_t *eng,
+            allocator_t *alc, free_func_t free_func)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(alc)
+        , malloc_func_(nullptr)
+        , free_func_(free_func) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -114,6 +131,21 @@ struct constant_tensor_cache_t {
 
     size_t get_size() const;
 
+    // Content-addressed deduplication of constant buffers. If a live buffer
+    // with the same size and content as the given one was already
+    // deduplicated, it is returned instead of the given buffer so that
+    // identical constants (eg. the packed weights of several replicas of the
+    // same model) are stored only once. When a shared store directory is set,
+    // the content is also published to a file in this directory and the
+    // returned buffer is a read-only mapping of it, so that processes on the
+    // same host share a single copy. The given buffer must be host accessible
+    // and fully initialized, and its content must be placed relatively to the
+    // first address aligned to the given alignment.
+    cached_t dedup(const cached_t &buffer, size_t alignment);
+
+    bool is_dedup_enabled() const { return dedup_enabled_; }
+    void set_dedup(bool enable, const std::string &shared_store_dir = "");
+
     // The key_t is composed of two parts: backend id and backend specific key.
     // The backend id occupies 4 bits, and the backend specific key occupies the
     // remained 60 bits. So backends should ensure not encode any information in
@@ -146,6 +178,8 @@ private:
             : value_(value), timestamp_(timestamp) {}
     };
 
+    cached_t map_shared_buffer(const cached_t &buffer, size_t hash) const;
+
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
         return *constant_map_;
     }
@@ -163,6 +197,15 @@ private:
     std::string name_;
     std::atomic<size_t> capacity_in_bytes_;
     std::atomic<int32_t> counter_;
+
+    // The deduplicated buffers indexed by the hash of their content. Weak
+    // references are kept so that the index doesn't extend the lifetime of
+    // the buffers.
+    std::unordered_multimap<size_t, std::weak_ptr<constant_buffer_t>>
+            content_map_;
+    std::mutex content_mutex_;
+    std::atomic<bool> dedup_enabled_;
+    std::string shared_store_dir_;
 };
 
 constant_tensor_cache_t *get_constant_tensor_cache(
@@ -78,6 +78,7 @@ bool attr_same_pd_check {false};
 bool check_ref_impl {false};
 
 execution_mode_t execution_mode {execution_mode_t::direct};
+nt_stores_t nt_stores {nt_stores_t::automatic};
 
 int main(int argc, char **argv) {
     using namespace parser;
@@ -949,6 +949,8 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--cold-cache=" << cold_cache_input << " ";
     if (canonical || execution_mode != execution_mode_t::direct)
         s << "--execution-mode=" << execution_mode2str(execution_mode) << " ";
+    if (canonical || nt_stores != nt_stores_t::automatic)
+        s << "--nt-stores=" << nt_stores2str(nt_stores) << " ";
 
     return s;
 }
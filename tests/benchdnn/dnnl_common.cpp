@@ -1570,6 +1570,39 @@ execution_mode_t str2execution_mode(const char *str) {
     return execution_mode_t::direct;
 }
 
+const char *nt_stores2str(nt_stores_t mode) {
+    switch (mode) {
+        case nt_stores_t::automatic: return "auto";
+        case nt_stores_t::always: return "always";
+        case nt_stores_t::never: return "never";
+    }
+    assert(!"unknown nt stores mode");
+    return "";
+}
+
+nt_stores_t str2nt_stores(const char *str) {
+    if (!strcasecmp("auto", str)) return nt_stores_t::automatic;
+    if (!strcasecmp("always", str)) return nt_stores_t::always;
+    if (!strcasecmp("never", str)) return nt_stores_t::never;
+
+    BENCHDNN_PRINT(
+            0, "%s", "Error: nt stores mode value is not recognized.\n");
+    SAFE_V(FAIL);
+    return nt_stores_t::automatic;
+}
+
+void init_nt_stores_settings() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    using namespace dnnl::impl::cpu::platform;
+    // Do nothing when the mode is `auto` to respect ONEDNN_CPU_NT_STORES.
+    if (nt_stores == nt_stores_t::automatic) return;
+    const auto mode = nt_stores == nt_stores_t::always
+            ? nt_stores_mode_t::always
+            : nt_stores_mode_t::never;
+    DNN_SAFE_V(set_nt_stores_mode(mode));
+#endif
+}
+
 static void maybe_print_cpu_engine_error_message() {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
     fprintf(stderr,
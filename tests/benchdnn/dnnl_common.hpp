@@ -690,6 +690,15 @@ extern execution_mode_t execution_mode;
 const char *execution_mode2str(execution_mode_t mode);
 execution_mode_t str2execution_mode(const char *str);
 
+// Non-temporal store policy of CPU primitives, `automatic` keeps the library
+// choice.
+enum class nt_stores_t { automatic, always, never };
+extern nt_stores_t nt_stores;
+
+const char *nt_stores2str(nt_stores_t mode);
+nt_stores_t str2nt_stores(const char *str);
+void init_nt_stores_settings();
+
 float reorder_rescale_factor();
 
 // The function converts a memory descriptor dims into a `dims_t` object under
@@ -46,6 +46,9 @@ const char *engine_kind2str(dnnl_engine_kind_t kind);
 /* scratchpad mode */
 const char *scratchpad_mode2str(dnnl_scratchpad_mode_t mode);
 
+/* huge pages mode */
+const char *huge_pages_mode2str(dnnl_huge_pages_mode_t mode);
+
 /* fpmath mode */
 const char *fpmath_mode2str(dnnl_fpmath_mode_t mode);
 
@@ -1741,6 +1741,10 @@ const char *scratchpad_mode2str(dnnl_scratchpad_mode_t mode) {
     return dnnl_scratchpad_mode2str(mode);
 }
 
+const char *huge_pages_mode2str(dnnl_huge_pages_mode_t mode) {
+    return dnnl_huge_pages_mode2str(mode);
+}
+
 const char *fpmath_mode2str(dnnl_fpmath_mode_t mode) {
     return dnnl_fpmath_mode2str(mode);
 }
@@ -1127,6 +1127,18 @@ static bool parse_cpu_isa_hints(
     return parsed;
 }
 
+static bool parse_nt_stores(
+        const char *str, const std::string &option_name = "nt-stores") {
+    static const std::string help
+            = "MODE    (Default: `auto`)\n    Specifies the non-temporal "
+              "store policy for the output of memory bound CPU primitives.\n"
+              "    `MODE` values can be `auto`, `always` or `never`.\n";
+    const bool parsed = parse_single_value_option(nt_stores,
+            nt_stores_t::automatic, str2nt_stores, str, option_name, help);
+    if (parsed) init_nt_stores_settings();
+    return parsed;
+}
+
 static bool parse_engine(
         const char *str, const std::string &option_name = "engine") {
     static const std::string help
@@ -1586,9 +1598,10 @@ bool parse_bench_settings(const char *str) {
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_start(str)
-            || parse_stream_kind(str) || parse_summary(str)
-            || parse_verbose(str) || parse_execution_mode(str);
+            || parse_mode_modifier(str) || parse_nt_stores(str)
+            || parse_start(str) || parse_stream_kind(str)
+            || parse_summary(str) || parse_verbose(str)
+            || parse_execution_mode(str);
 
     // Last condition makes this help message to be triggered once driver_name
     // is already known.
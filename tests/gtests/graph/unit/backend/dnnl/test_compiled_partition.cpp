@@ -20,6 +20,7 @@
 #include "interface/tensor.hpp"
 
 #include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/kernels/dynamic_shape.hpp"
 #include "backend/dnnl/kernels/pool.hpp"
 
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
@@ -29,6 +30,15 @@
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
 
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
 TEST(test_compiled_partition, Relu) {
     graph::engine_t *eng = get_engine();
 
@@ -104,6 +114,139 @@ TEST(test_compiled_partition, Relu) {
     }
 }
 
+TEST(test_compiled_partition, ReluDynamicShape) {
+    graph::engine_t *eng = get_engine();
+
+    graph::op_t relu_op(graph::op_kind::ReLU, "relu");
+
+    const graph::logical_tensor_t lt_in = utils::logical_tensor_init(
+            /* tid= */ 1, {-1, 4}, graph::data_type::f32);
+    const graph::logical_tensor_t lt_out
+            = utils::logical_tensor_init(/* tid= */ 2, {-1, 4},
+                    graph::data_type::f32, graph::layout_type::any);
+
+    relu_op.add_input(lt_in);
+    relu_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", "2", 1);
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_in};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_out};
+    graph::status_t status = p.compile(&cp, lt_inputs, lt_outputs, eng);
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", "0", 1);
+    ASSERT_EQ(status, graph::status::success);
+
+    graph::logical_tensor_t query_out_lt;
+    ASSERT_EQ(cp.query_logical_tensor(lt_out.id, &query_out_lt),
+            graph::status::success);
+    ASSERT_EQ(query_out_lt.layout_type, graph::layout_type::strided);
+
+    graph::stream_t *strm = get_stream();
+    // the rows are executed in power of two buckets, 3 = 2 + 1 and 5 = 4 + 1,
+    // and 5 evicts the kernels of both 2 and 1 from the kernel cache
+    for (int64_t rows : {2, 3, 2, 5, 2}) {
+        const graph::logical_tensor_t in = utils::logical_tensor_init(
+                lt_in.id, {rows, 4}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                lt_out.id, {rows, 4}, graph::data_type::f32);
+        const size_t nelems = static_cast<size_t>(rows * 4);
+
+        std::vector<float> data_in(nelems), data_out(nelems);
+        for (size_t i = 0; i < nelems; i++)
+            data_in[i] = static_cast<float>(i) - static_cast<float>(nelems / 2);
+
+        test_tensor_t t_in(in, eng, data_in), t_out(out, eng, data_out);
+        std::vector<graph::tensor_t> t_inputs {t_in.get()};
+        std::vector<graph::tensor_t> t_outputs {t_out.get()};
+        EXPECT_SUCCESS(cp.execute(strm, t_inputs, t_outputs));
+        strm->wait();
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_FLOAT_EQ(std::max(data_in[i], 0.f), data_out[i]);
+    }
+}
+
+TEST(test_compiled_partition, ReluDynamicShapeRecompile) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    graph::op_t relu_op(graph::op_kind::ReLU, "relu");
+
+    const graph::logical_tensor_t lt_in = utils::logical_tensor_init(
+            /* tid= */ 1, {-1, 4}, graph::data_type::f32);
+    const graph::logical_tensor_t lt_out
+            = utils::logical_tensor_init(/* tid= */ 2, {-1, 4},
+                    graph::data_type::f32, graph::layout_type::any);
+
+    relu_op.add_input(lt_in);
+    relu_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", "2", 1);
+    graph::dnnl_impl::dynamic_shape_kernel_t kernel(
+            part->get_kernel_creator());
+    std::vector<graph::logical_tensor_t> lt_inputs {lt_in};
+    std::vector<graph::logical_tensor_t> lt_outputs {lt_out};
+    graph::status_t status
+            = kernel.compile(part.get(), eng, lt_inputs, lt_outputs);
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", "0", 1);
+    ASSERT_EQ(status, graph::status::success);
+    ASSERT_EQ(kernel.get_num_compilations(), 0U);
+
+    // The rows are executed in power of two buckets: 3 = 2 + 1 and
+    // 5 = 4 + 1. With two cached kernels, 2 and 3 share the kernel of 2, and
+    // 5 evicts the kernels of 2 and 1, so the last execution recompiles 2.
+    const std::vector<std::pair<int64_t, size_t>> rows_and_compilations {
+            {2, 1}, {3, 2}, {2, 2}, {5, 4}, {2, 5}};
+
+    graph::stream_t *strm = get_stream();
+    for (const auto &rc : rows_and_compilations) {
+        const int64_t rows = rc.first;
+        const graph::logical_tensor_t in = utils::logical_tensor_init(
+                lt_in.id, {rows, 4}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                lt_out.id, {rows, 4}, graph::data_type::f32);
+        const size_t nelems = static_cast<size_t>(rows * 4);
+
+        std::vector<float> data_in(nelems), data_out(nelems);
+        for (size_t i = 0; i < nelems; i++)
+            data_in[i] = static_cast<float>(i) - static_cast<float>(nelems / 2);
+
+        test_tensor_t t_in(in, eng, data_in), t_out(out, eng, data_out);
+        std::vector<graph::tensor_t> t_inputs {t_in.get()};
+        std::vector<graph::tensor_t> t_outputs {t_out.get()};
+        EXPECT_SUCCESS(kernel.execute(strm, t_inputs, t_outputs));
+        strm->wait();
+        ASSERT_EQ(kernel.get_num_compilations(), rc.second);
+        ASSERT_LE(kernel.get_num_compiled_kernels(), 2U);
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_FLOAT_EQ(std::max(data_in[i], 0.f), data_out[i]);
+    }
+}
+
 TEST(test_compiled_partition, SearchRequiredInputsOutputs) {
     graph::engine_t *eng = get_engine();
 
@@ -13,6 +13,15 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
 #include "gtest/gtest.h"
 
 #include "interface/constant_tensor_cache.hpp"
@@ -110,3 +119,90 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+TEST(test_constant_cache, DedupBuffers) {
+    graph::engine_t &engine = *get_engine();
+    SKIP_IF(engine.kind() == graph::engine_kind::gpu,
+            "constant buffer deduplication is only supported on cpu");
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    using cached_t = graph::constant_tensor_cache_t::cached_t;
+    const size_t size = 1000;
+    const auto make_buffer = [&](char value) {
+        cached_t buffer = std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+                size, p_engine_, g_alloc_);
+        std::fill(buffer->data<char>(), buffer->data<char>() + size, value);
+        return buffer;
+    };
+
+    graph::constant_tensor_cache_t cache(4 * size);
+    cached_t c_buffer1 = make_buffer(1);
+    cached_t c_buffer2 = make_buffer(1);
+    cached_t c_buffer3 = make_buffer(2);
+    ASSERT_EQ(cache.dedup(c_buffer1, 1), c_buffer1);
+    ASSERT_EQ(cache.dedup(c_buffer2, 1), c_buffer1);
+    ASSERT_EQ(cache.dedup(c_buffer3, 1), c_buffer3);
+
+    // buffers shared by several entries are only counted once
+    std::promise<cached_t> c_promise1, c_promise2;
+    cache.get_or_add(0, 1, size, c_promise1.get_future());
+    c_promise1.set_value(c_buffer1);
+    cache.get_or_add(0, 2, size, c_promise2.get_future());
+    c_promise2.set_value(cache.dedup(c_buffer2, 1));
+    ASSERT_EQ(cache.get_size(), size);
+
+    // the index doesn't keep the buffers alive
+    ASSERT_EQ(cache.set_capacity(0), graph::status::success);
+    c_buffer1.reset();
+    c_buffer2 = make_buffer(1);
+    ASSERT_EQ(cache.dedup(c_buffer2, 1), c_buffer2);
+}
+
+#ifndef _WIN32
+TEST(test_constant_cache, DedupSharedStore) {
+    graph::engine_t &engine = *get_engine();
+    SKIP_IF(engine.kind() == graph::engine_kind::gpu,
+            "constant buffer deduplication is only supported on cpu");
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    char dir[] = "/tmp/onednn_graph_constant_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+
+    using cached_t = graph::constant_tensor_cache_t::cached_t;
+    const size_t size = 1000;
+    cached_t c_buffer = std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            size, p_engine_, g_alloc_);
+    for (size_t i = 0; i < size; i++)
+        c_buffer->data<char>()[i] = static_cast<char>(i);
+
+    // two caches play the role of two processes sharing the store
+    graph::constant_tensor_cache_t cache1(4 * size), cache2(4 * size);
+    cache1.set_dedup(true, dir);
+    cache2.set_dedup(true, dir);
+    cached_t mapped1 = cache1.dedup(c_buffer, 1);
+    cached_t mapped2 = cache2.dedup(c_buffer, 1);
+    ASSERT_NE(mapped1, c_buffer);
+    ASSERT_NE(mapped2, c_buffer);
+    ASSERT_EQ(mapped1->size(), size);
+    ASSERT_EQ(std::memcmp(mapped1->data<char>(), c_buffer->data<char>(), size),
+            0);
+    ASSERT_EQ(std::memcmp(mapped2->data<char>(), c_buffer->data<char>(), size),
+            0);
+
+    mapped1.reset();
+    mapped2.reset();
+    DIR *d = opendir(dir);
+    ASSERT_NE(d, nullptr);
+    size_t num_files = 0;
+    while (struct dirent *entry = readdir(d)) {
+        if (entry->d_name[0] == '.') continue;
+        unlink((std::string(dir) + "/" + entry->d_name).c_str());
+        num_files++;
+    }
+    closedir(d);
+    rmdir(dir);
+    ASSERT_EQ(num_files, 1U);
+}
+#endif
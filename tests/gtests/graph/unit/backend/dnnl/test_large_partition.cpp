@@ -19,6 +19,8 @@
 
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/inter_op_scheduler.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
@@ -341,6 +343,142 @@ TEST(test_large_partition_execute, F32Resnet50Stage2Block) {
                     /*atol*/ 1e-5f));
 }
 
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockInterOp_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    utils::id_generator_t id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    custom_setenv("_ONEDNN_GRAPH_INTER_OP_PARALLEL", "1", 1);
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    custom_setenv("_ONEDNN_GRAPH_INTER_OP_PARALLEL", "0", 1);
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, ref_outputs_data;
+    std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(utils::product(ltw(lt).vdims()));
+        fill_data(inputs_data.back(), ltw(lt).data_type());
+        inputs_ts.emplace_back(*lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        const std::vector<int64_t> dims = ltw(compiled_output).vdims();
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(size);
+        outputs_ts.emplace_back(compiled_output, eng, outputs_data.back());
+        ref_outputs_data.emplace_back(size);
+        ref_outputs_ts.emplace_back(
+                compiled_output, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(
+            allclose<float>(outputs_ts[0], ref_outputs_ts[0], /*rtol*/ 1e-5f,
+                    /*atol*/ 1e-5f));
+}
+
+TEST(test_large_partition_inter_op, BuildWaves) {
+    using namespace dnnl::impl::graph::dnnl_impl;
+    dnnl::engine p_eng(dnnl::engine::kind::cpu, 0);
+    dnnl::memory::desc md({16, 16}, dnnl::memory::data_type::f32,
+            dnnl::memory::format_tag::ab);
+    dnnl::memory a(md, p_eng), b(md, p_eng), c(md, p_eng), d(md, p_eng);
+
+    // 0: a -> b, 1: a -> c, 2: (b, c) -> d, 3: d -> a
+    std::vector<exec_args> args {
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}},
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, c}},
+            {{DNNL_ARG_SRC_0, b}, {DNNL_ARG_SRC_1, c}, {DNNL_ARG_DST, d}},
+            {{DNNL_ARG_SRC, d}, {DNNL_ARG_DST, a}},
+    };
+    auto waves = inter_op_scheduler_t::build_waves(
+            std::vector<bool>(args.size(), false), args);
+    ASSERT_EQ(waves.size(), 3U);
+    ASSERT_EQ(waves[0], std::vector<size_t>({0, 1}));
+    ASSERT_EQ(waves[1], std::vector<size_t>({2}));
+    ASSERT_EQ(waves[2], std::vector<size_t>({3}));
+
+    // constant executables are not scheduled
+    waves = inter_op_scheduler_t::build_waves(
+            {true, false, false, false}, args);
+    ASSERT_EQ(waves.size(), 3U);
+    ASSERT_EQ(waves[0], std::vector<size_t>({1}));
+}
+
+TEST(test_large_partition_inter_op, PlanWave) {
+    using namespace dnnl::impl::graph::dnnl_impl;
+    const size_t kb = 1024, mb = 1024 * 1024;
+
+    // small independent ops are executed by single-thread teams
+    auto plan = inter_op_scheduler_t::plan_wave(
+            {64 * kb, 64 * kb, 64 * kb, 64 * kb}, 8, 1);
+    ASSERT_TRUE(plan.is_concurrent());
+    ASSERT_EQ(plan.teams.size(), 4U);
+    for (auto nthr : plan.team_nthr)
+        ASSERT_EQ(nthr, 1);
+
+    // large ops are better executed one by one with all threads
+    plan = inter_op_scheduler_t::plan_wave({64 * mb, 64 * mb}, 64, 1);
+    ASSERT_FALSE(plan.is_concurrent());
+    ASSERT_EQ(plan.teams[0], std::vector<size_t>({0, 1}));
+
+    // with resizable teams, all threads are split between the teams
+    plan = inter_op_scheduler_t::plan_wave({mb, mb, 256 * kb}, 64, 64);
+    ASSERT_TRUE(plan.is_concurrent());
+    ASSERT_EQ(plan.teams.size(), 3U);
+    int total_nthr = 0;
+    for (auto nthr : plan.team_nthr)
+        total_nthr += nthr;
+    ASSERT_EQ(total_nthr, 64);
+    ASSERT_LT(plan.team_nthr[2], plan.team_nthr[0]);
+
+    // no concurrency without threads to split
+    plan = inter_op_scheduler_t::plan_wave({mb, mb}, 64, 0);
+    ASSERT_FALSE(plan.is_concurrent());
+}
+
 TEST(test_large_partition_execute, ItexInt8Resnet50Stage2Block) {
     SKIP_IF_NV_GPU("not supported on NVIDIA GPU");
     graph::engine_t *eng = get_engine();
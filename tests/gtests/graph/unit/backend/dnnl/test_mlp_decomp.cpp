@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
+// src[M, K] -> gate/up matmuls -> act(gate) * up -> down matmul -> dst[M, N]
+static void construct_gated_mlp(graph::graph_t *agraph, dim_t M, dim_t K,
+        dim_t I, dim_t N, bool decomposed_swish) {
+    const auto dt = graph::data_type::f32;
+
+    size_t lt_id = 0;
+    auto src = utils::logical_tensor_init(lt_id++, {M, K}, dt);
+    auto wei_gate = utils::logical_tensor_init(lt_id++, {K, I}, dt);
+    auto wei_up = utils::logical_tensor_init(lt_id++, {K, I}, dt);
+    auto wei_down = utils::logical_tensor_init(lt_id++, {I, N}, dt);
+    auto gate_out = utils::logical_tensor_init(lt_id++, {M, I}, dt);
+    auto up_out = utils::logical_tensor_init(lt_id++, {M, I}, dt);
+    auto sigmoid_out = utils::logical_tensor_init(lt_id++, {M, I}, dt);
+    auto act_out = utils::logical_tensor_init(lt_id++, {M, I}, dt);
+    auto mul_out = utils::logical_tensor_init(lt_id++, {M, I}, dt);
+    auto dst = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+
+    graph::op_t fc_gate {0, graph::op_kind::MatMul, "fc_gate"};
+    fc_gate.add_input(src);
+    fc_gate.add_input(wei_gate);
+    fc_gate.add_output(gate_out);
+
+    graph::op_t fc_up {1, graph::op_kind::MatMul, "fc_up"};
+    fc_up.add_input(src);
+    fc_up.add_input(wei_up);
+    fc_up.add_output(up_out);
+
+    graph::op_t sigmoid {2, graph::op_kind::Sigmoid, "sigmoid"};
+    graph::op_t swish {3, graph::op_kind::Multiply, "swish"};
+    graph::op_t gelu {4, graph::op_kind::GELU, "gelu"};
+    if (decomposed_swish) {
+        sigmoid.add_input(gate_out);
+        sigmoid.add_output(sigmoid_out);
+        swish.add_input(gate_out);
+        swish.add_input(sigmoid_out);
+        swish.add_output(act_out);
+    } else {
+        gelu.add_input(gate_out);
+        gelu.add_output(act_out);
+    }
+
+    graph::op_t mul {5, graph::op_kind::Multiply, "mul"};
+    mul.add_input(act_out);
+    mul.add_input(up_out);
+    mul.add_output(mul_out);
+
+    graph::op_t fc_down {6, graph::op_kind::MatMul, "fc_down"};
+    fc_down.add_input(mul_out);
+    fc_down.add_input(wei_down);
+    fc_down.add_output(dst);
+
+    agraph->add_op(&fc_gate);
+    agraph->add_op(&fc_up);
+    if (decomposed_swish) {
+        agraph->add_op(&sigmoid);
+        agraph->add_op(&swish);
+    } else {
+        agraph->add_op(&gelu);
+    }
+    agraph->add_op(&mul);
+    agraph->add_op(&fc_down);
+}
+
+// Compiles and executes the gated mlp partition with the fused kernel and
+// with the primitive based kernel, and compares the results.
+static void test_gated_mlp(
+        dim_t M, dim_t K, dim_t I, dim_t N, bool decomposed_swish) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::graph_t g(eng->kind());
+    construct_gated_mlp(&g, M, K, I, N, decomposed_swish);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass(decomposed_swish ? "gated_mlp_v1" : "gated_mlp");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 4U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        // set output to be strided
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    const auto run = [&](const char *force_prim) {
+        custom_setenv("_ONEDNN_GRAPH_MLP_FORCE_PRIMITIVE", force_prim, 1);
+        graph::compiled_partition_t cp(p);
+        EXPECT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(outputs[0]->id, &compiled_output);
+        std::vector<test_tensor_t> outputs_ts;
+        outputs_ts.emplace_back(compiled_output, eng);
+        EXPECT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+        return outputs_ts[0];
+    };
+
+    const test_tensor_t ref = run("1");
+    const test_tensor_t dst = run("0");
+    ASSERT_TRUE(allclose<float>(dst, ref, /*rtol*/ 1e-4f, /*atol*/ 1e-4f));
+}
+
+TEST(test_mlp_decomp_execute, F32GatedMlpSwishDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // M and I are not multiples of the blocks to cover the tails
+    test_gated_mlp(250, 64, 2112, 48, true);
+}
+
+TEST(test_mlp_decomp_execute, F32GatedMlpGeluDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    test_gated_mlp(250, 64, 2112, 48, false);
+}
@@ -19,6 +19,7 @@
 
 #include "backend/dnnl/common.hpp"
 #include "backend/dnnl/dnnl_backend.hpp"
+#include "backend/dnnl/exec_tracer.hpp"
 #include "backend/dnnl/op_executable.hpp"
 #include "backend/dnnl/passes/lower.hpp"
 
@@ -94,3 +95,49 @@ TEST(test_op_executable, DummyImpl) {
             ::sycl::info::event_command_status::complete);
 }
 #endif
+
+namespace {
+
+struct counting_executable_t : public dnnl_impl::op_executable_t {
+    void execute(const dnnl::stream &stream,
+            const std::unordered_map<int, dnnl::memory> &args) const override {
+        ++n_calls;
+    }
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const dnnl::stream &stream,
+            const std::unordered_map<int, dnnl::memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        ++n_calls;
+        return {};
+    }
+#endif
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const dnnl::stream &stream,
+            const std::unordered_map<int, dnnl::memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        ++n_calls;
+        return nullptr;
+    }
+#endif
+    mutable int n_calls = 0;
+};
+
+} // namespace
+
+TEST(test_op_executable, TracedExecutable) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() != graph::engine_kind::cpu,
+            "skip traced executable test for gpu engine.");
+    dnnl::engine p_engine = dnnl_impl::make_dnnl_engine(*engine);
+    dnnl::stream p_stream = dnnl_impl::make_dnnl_stream(p_engine, *strm);
+
+    graph::op_t op {7, graph::op_kind::Wildcard, "traced_op"};
+    auto exec = std::make_shared<counting_executable_t>();
+    auto traced = dnnl_impl::make_traced_executable(exec, op);
+    ASSERT_NE(traced, exec);
+
+    traced->execute(p_stream, {});
+    traced->execute(p_stream, {});
+    ASSERT_EQ(exec->n_calls, 2);
+}
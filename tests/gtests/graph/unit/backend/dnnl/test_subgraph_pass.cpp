@@ -1824,6 +1824,48 @@ TEST(test_subgraph_pass_layout_propagation, Transpose) {
     ASSERT_EQ(md_stride, out_stride);
 }
 
+TEST(test_subgraph_pass_layout_propagation, PlainLayoutForSmallMatMulChain) {
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    if (p_eng.get_kind() != dnnl::engine::kind::cpu) return;
+
+    graph::op_t op1(0, graph::op_kind::MatMul, "op1");
+    graph::op_t op2(1, graph::op_kind::MatMul, "op2");
+
+    auto src = logical_tensor_init(0, {8, 16}, graph::data_type::f32);
+    auto wei1 = logical_tensor_init(1, {16, 16}, graph::data_type::f32);
+    auto dst1 = logical_tensor_init(2, {8, 16}, graph::data_type::f32);
+    auto wei2 = logical_tensor_init(3, {16, 16}, graph::data_type::f32);
+    auto dst2 = logical_tensor_init(4, {8, 16}, graph::data_type::f32);
+    op1.add_input(src);
+    op1.add_input(wei1);
+    op1.add_output(dst1);
+    op2.add_input(dst1);
+    op2.add_input(wei2);
+    op2.add_output(dst2);
+
+    graph::graph_t g;
+    g.add_op(&op1);
+    g.add_op(&op2);
+    g.finalize();
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, true, /* reset_layout */ false);
+
+    ASSERT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+    ASSERT_EQ(dnnl_impl::layout_propagation(subgraph), graph::status::success);
+
+    // Reordering the plain partition input and output costs more than the
+    // small matmuls can gain from blocked activations.
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_matmul) continue;
+        ASSERT_TRUE(op->get_attr<bool>(
+                dnnl_impl::op_attr::prefer_plain_layout));
+        const auto out_lt = op->get_output_value(0)->get_logical_tensor();
+        ASSERT_EQ(out_lt.layout_type, graph::layout_type::strided);
+    }
+}
+
 TEST(test_subgraph_pass, FuseTypecastBeforeFusePostops) {
     graph::engine_t *engine = get_engine();
 
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/huge_pages.hpp"
+#include "src/common/memory_debug.hpp"
+
+namespace dnnl {
+
+#ifdef __linux__
+TEST(test_huge_pages, Alignment) {
+    using namespace impl;
+
+    const int alignment = 64;
+    for (auto mode : {huge_pages_mode::any, huge_pages_mode::none,
+                 huge_pages_mode::transparent, huge_pages_mode::hugetlb}) {
+        const size_t page_size = get_huge_page_size(mode);
+        const auto lib_mode
+                = mode == huge_pages_mode::any ? get_huge_pages_mode() : mode;
+        ASSERT_GT(page_size, 0u);
+
+        for (size_t size : {size_t(alignment), page_size / 2, page_size,
+                     3 * page_size + page_size / 2}) {
+            void *ptr = malloc_huge_pages(size, alignment, mode);
+            ASSERT_NE(ptr, nullptr);
+            const auto addr = reinterpret_cast<uintptr_t>(ptr);
+            EXPECT_EQ(addr % alignment, 0u);
+
+            // Buffers spanning huge pages start on a huge page boundary, so
+            // that they are fully backed by huge pages. Without huge pages
+            // (or with the memory debug mode) only the requested alignment
+            // holds.
+            const bool use_huge_pages = lib_mode != huge_pages_mode::none
+                    && page_size > (size_t)getpagesize()
+                    && !memory_debug::is_mem_debug();
+            if (use_huge_pages && size >= page_size)
+                EXPECT_EQ(addr % page_size, 0u);
+
+            std::memset(ptr, 0xA5, size);
+            free_huge_pages(ptr);
+        }
+    }
+}
+#endif
+
+} // namespace dnnl
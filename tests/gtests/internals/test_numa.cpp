@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+namespace dnnl {
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(test_numa_topology, Consistency) {
+    using namespace impl::cpu::platform;
+
+    const int nnodes = get_numa_node_count();
+    ASSERT_GE(nnodes, 1);
+
+    int ncpus = 0;
+    for (int node = 0; node < nnodes; node++) {
+        const std::vector<int> cpus = get_numa_node_cpus(node);
+        for (int cpu : cpus)
+            EXPECT_EQ(get_numa_node_of_cpu(cpu), node);
+        ncpus += (int)cpus.size();
+    }
+    EXPECT_GE(ncpus, 1);
+
+    EXPECT_TRUE(get_numa_node_cpus(nnodes).empty());
+    EXPECT_TRUE(get_numa_node_cpus(-1).empty());
+
+    const int cur_node = get_current_numa_node();
+    EXPECT_GE(cur_node, 0);
+    EXPECT_LT(cur_node, nnodes);
+
+    // NUMA aware mode is meaningless with a single node.
+    if (nnodes == 1) { EXPECT_FALSE(is_numa_aware()); }
+}
+
+TEST(test_numa_topology, PagePlacement) {
+    using namespace impl::cpu::platform;
+
+    const size_t page_size = impl::cpu::PAGE_4K;
+    const size_t size = 8 * page_size;
+    std::vector<char> buf(size, 1);
+    SKIP_IF(get_numa_node_of_address(buf.data()) < 0,
+            "page placement is not reported by the OS");
+
+    const int node = get_current_numa_node();
+    ASSERT_TRUE(move_to_numa_node(buf.data(), size, node));
+    for (size_t off = 0; off < size; off += page_size)
+        EXPECT_EQ(get_numa_node_of_address(buf.data() + off), node);
+
+    EXPECT_FALSE(move_to_numa_node(buf.data(), size, get_numa_node_count()));
+    EXPECT_FALSE(move_to_numa_node(buf.data(), size, -1));
+}
+#endif
+
+} // namespace dnnl
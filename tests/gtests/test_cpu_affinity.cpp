@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+#if defined(__linux__)
+HANDLE_EXCEPTIONS_FOR_TEST(cpu_affinity_test_t, TestStreamAffinity) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    ASSERT_TRUE(get_cpu_affinity(s).empty());
+
+    cpu_set_t mask;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(cpu_set_t), &mask), 0);
+    std::vector<int> cores;
+    for (int core = 0; core < CPU_SETSIZE && cores.size() < 2; core++)
+        if (CPU_ISSET(core, &mask)) cores.push_back(core);
+
+    set_cpu_affinity(s, cores);
+    ASSERT_EQ(get_cpu_affinity(s), cores);
+
+    const memory::dims dims = {8, 64, 32, 32};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::nchw);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src);
+    eltwise_forward(pd).execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    // The affinity of the calling thread is restored after the execution.
+    cpu_set_t mask_after;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(cpu_set_t), &mask_after), 0);
+    ASSERT_TRUE(CPU_EQUAL(&mask, &mask_after));
+
+    // Nested activations, as done by primitives executing other primitives on
+    // the same stream, keep the outermost affinity until it ends.
+    {
+        using namespace impl::affinity_utils;
+        auto list = std::make_shared<const std::vector<int>>(cores);
+        ASSERT_TRUE(activate_cpu_affinity(list));
+        ASSERT_FALSE(activate_cpu_affinity(list));
+        ASSERT_FALSE(deactivate_cpu_affinity());
+        ASSERT_EQ(get_active_cpu_affinity(), list.get());
+        ASSERT_TRUE(deactivate_cpu_affinity());
+        ASSERT_EQ(get_active_cpu_affinity(), nullptr);
+
+        ASSERT_EQ(::sched_getaffinity(0, sizeof(cpu_set_t), &mask_after), 0);
+        ASSERT_TRUE(CPU_EQUAL(&mask, &mask_after));
+    }
+
+    EXPECT_ANY_THROW(set_cpu_affinity(s, {-1}));
+    EXPECT_ANY_THROW(set_cpu_affinity(s, {CPU_SETSIZE}));
+    ASSERT_EQ(get_cpu_affinity(s), cores);
+
+    set_cpu_affinity(s, {});
+    ASSERT_TRUE(get_cpu_affinity(s).empty());
+}
+#endif
+
+} // namespace dnnl
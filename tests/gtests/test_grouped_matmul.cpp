@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+class grouped_matmul_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng_ = engine(engine::kind::cpu, 0);
+        strm_ = stream(eng_);
+    }
+
+    // Groups of different sizes including an empty one, the last rows of
+    // src are not covered by any group.
+    const std::vector<int32_t> offsets_ = {0, 37, 37, 41, 300};
+    const memory::dim M_ = 310, K_ = 64, N_ = 48;
+    memory::dim G() const { return (memory::dim)offsets_.size() - 1; }
+
+    memory make_offsets() const {
+        memory m({{G() + 1}, dt::s32, tag::a}, eng_);
+        int32_t *ptr = static_cast<int32_t *>(m.get_data_handle());
+        for (size_t i = 0; i < offsets_.size(); i++)
+            ptr[i] = offsets_[i];
+        return m;
+    }
+
+    // Small integers keep all the sums exact in f32.
+    template <typename T>
+    static void fill(const memory &m, int seed) {
+        T *ptr = static_cast<T *>(m.get_data_handle());
+        const size_t nelems = m.get_desc().get_size() / sizeof(T);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = static_cast<T>(((int)i * 7 + seed) % 11 - 5);
+    }
+
+    // `scales` holds G x N values or is empty.
+    template <typename wei_t>
+    void check(const memory &src, const memory &wei, const memory &dst,
+            const std::vector<float> &scales) const {
+        const float *src_ptr = static_cast<float *>(src.get_data_handle());
+        const wei_t *wei_ptr = static_cast<wei_t *>(wei.get_data_handle());
+        const float *dst_ptr = static_cast<float *>(dst.get_data_handle());
+        for (memory::dim g = 0; g < G(); g++)
+            for_(memory::dim m = offsets_[g]; m < offsets_[g + 1]; m++)
+            for (memory::dim n = 0; n < N_; n++) {
+                const float s = scales.empty() ? 1.f : scales[g * N_ + n];
+                float acc = 0.f;
+                for (memory::dim k = 0; k < K_; k++)
+                    acc += src_ptr[m * K_ + k]
+                            * (s * wei_ptr[(g * K_ + k) * N_ + n]);
+                ASSERT_EQ(dst_ptr[m * N_ + n], acc);
+            }
+    }
+
+    engine eng_;
+    stream strm_;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(grouped_matmul_test_t, TestF32) {
+    memory::desc src_md({M_, K_}, dt::f32, tag::ab);
+    memory::desc wei_md({G(), K_, N_}, dt::f32, tag::abc);
+    memory::desc off_md({G() + 1}, dt::s32, tag::a);
+    memory::desc dst_md({M_, N_}, dt::f32, tag::ab);
+
+    auto pd = grouped_matmul::primitive_desc(
+            eng_, src_md, wei_md, off_md, dst_md);
+    ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_GROUP_OFFSETS),
+            off_md);
+
+    memory src(src_md, eng_), wei(wei_md, eng_), dst(dst_md, eng_);
+    fill<float>(src, 1);
+    fill<float>(wei, 2);
+    grouped_matmul(pd).execute(strm_,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_GROUP_OFFSETS, make_offsets()},
+                    {DNNL_ARG_DST, dst}});
+    strm_.wait();
+
+    check<float>(src, wei, dst, {});
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(grouped_matmul_test_t, TestS8Decompression) {
+    memory::desc src_md({M_, K_}, dt::f32, tag::ab);
+    memory::desc wei_md({G(), K_, N_}, dt::s8, tag::abc);
+    memory::desc off_md({G() + 1}, dt::s32, tag::a);
+    memory::desc dst_md({M_, N_}, dt::f32, tag::ab);
+
+    // Per expert and per output channel scales.
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::strict, true);
+    attr.set_scales_mask(DNNL_ARG_WEIGHTS, (1 << 0) | (1 << 2));
+
+    auto pd = grouped_matmul::primitive_desc(
+            eng_, src_md, wei_md, off_md, dst_md, attr, true);
+    SKIP_IF(!pd, "weights decompression is not supported");
+
+    memory src(src_md, eng_), wei(wei_md, eng_), dst(dst_md, eng_);
+    memory sc({{G() * N_}, dt::f32, tag::a}, eng_);
+    fill<float>(src, 1);
+    fill<int8_t>(wei, 2);
+    std::vector<float> scales(G() * N_);
+    for (size_t i = 0; i < scales.size(); i++)
+        scales[i] = 0.25f * (1 + i % 4);
+    float *sc_ptr = static_cast<float *>(sc.get_data_handle());
+    for (size_t i = 0; i < scales.size(); i++)
+        sc_ptr[i] = scales[i];
+
+    grouped_matmul(pd).execute(strm_,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_GROUP_OFFSETS, make_offsets()},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, sc},
+                    {DNNL_ARG_DST, dst}});
+    strm_.wait();
+
+    check<int8_t>(src, wei, dst, scales);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(grouped_matmul_test_t, TestBadOffsets) {
+    memory::desc src_md({M_, K_}, dt::f32, tag::ab);
+    memory::desc wei_md({G(), K_, N_}, dt::f32, tag::abc);
+    memory::desc off_md({G() + 1}, dt::s32, tag::a);
+    memory::desc dst_md({M_, N_}, dt::f32, tag::ab);
+
+    // The number of groups must match the weights.
+    memory::desc bad_off_md({G()}, dt::s32, tag::a);
+    EXPECT_THROW(grouped_matmul::primitive_desc(
+                         eng_, src_md, wei_md, bad_off_md, dst_md),
+            dnnl::error);
+
+    auto pd = grouped_matmul::primitive_desc(
+            eng_, src_md, wei_md, off_md, dst_md);
+    memory src(src_md, eng_), wei(wei_md, eng_), dst(dst_md, eng_);
+    memory off = make_offsets();
+    // Offsets must not decrease.
+    static_cast<int32_t *>(off.get_data_handle())[2] = 10;
+    EXPECT_THROW(grouped_matmul(pd).execute(strm_,
+                         {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                                 {DNNL_ARG_GROUP_OFFSETS, off},
+                                 {DNNL_ARG_DST, dst}}),
+            dnnl::error);
+}
+
+} // namespace dnnl
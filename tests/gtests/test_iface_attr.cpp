@@ -15,6 +15,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -116,6 +119,71 @@ TEST_F(attr_test_t, TestScratchpadModeEx) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestHugePagesMode) {
+    engine eng = get_test_engine();
+
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(huge_pages_mode::any, attr.get_huge_pages_mode());
+
+    // RNN inference always keeps its workspace in the scratchpad, which is
+    // large enough to span a few huge pages with these sizes.
+    const memory::dim T = 16, N = 64, C = 512;
+
+    memory::desc src_layer_md({T, N, C}, data_type::f32, tag::tnc);
+    memory::desc wei_layer_md({1, 1, C, 1, C}, data_type::f32, tag::ldigo);
+    memory::desc wei_iter_md({1, 1, C, 1, C}, data_type::f32, tag::ldigo);
+    memory::desc bias_md({1, 1, 1, C}, data_type::f32, tag::ldgo);
+    memory::desc dst_layer_md({T, N, C}, data_type::f32, tag::tnc);
+
+    auto src_layer = test::make_memory(src_layer_md, eng);
+    auto wei_layer = test::make_memory(wei_layer_md, eng);
+    auto wei_iter = test::make_memory(wei_iter_md, eng);
+    auto bias = test::make_memory(bias_md, eng);
+    fill_data<float>(src_layer_md.get_size() / sizeof(float), src_layer);
+    fill_data<float>(wei_layer_md.get_size() / sizeof(float), wei_layer);
+    fill_data<float>(wei_iter_md.get_size() / sizeof(float), wei_iter);
+    fill_data<float>(bias_md.get_size() / sizeof(float), bias);
+
+    std::vector<float> ref_dst;
+    for (auto m : {huge_pages_mode::any, huge_pages_mode::none,
+                 huge_pages_mode::transparent, huge_pages_mode::hugetlb}) {
+        attr.set_huge_pages_mode(m);
+        ASSERT_EQ(m, attr.get_huge_pages_mode());
+
+        auto rnn_pd = vanilla_rnn_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_tanh,
+                rnn_direction::unidirectional_left2right, src_layer_md,
+                memory::desc(), wei_layer_md, wei_iter_md, bias_md,
+                dst_layer_md, memory::desc(), attr);
+        ASSERT_GT(rnn_pd.query_s64(query::memory_consumption_s64), 0);
+
+        auto dst_layer = test::make_memory(dst_layer_md, eng);
+
+        stream s(eng);
+        vanilla_rnn_forward rnn_p(rnn_pd);
+        rnn_p.execute(s,
+                {{DNNL_ARG_SRC_LAYER, src_layer},
+                        {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                        {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                        {DNNL_ARG_BIAS, bias},
+                        {DNNL_ARG_DST_LAYER, dst_layer}});
+        s.wait();
+
+        // The pages backing the scratchpad must not change the results.
+        std::vector<float> dst(dst_layer_md.get_size() / sizeof(float));
+        {
+            auto mapped_dst = map_memory<float>(dst_layer);
+            const float *ptr = mapped_dst;
+            std::copy(ptr, ptr + dst.size(), dst.begin());
+        }
+        if (ref_dst.empty())
+            ref_dst = dst;
+        else
+            ASSERT_EQ(ref_dst, dst);
+    }
+}
+
 TEST_F(attr_test_t, TestDeterministic) {
     dnnl::primitive_attr attr;
     // Check the default value
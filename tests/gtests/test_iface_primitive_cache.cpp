@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/dispatch_cache.hpp"
 #include "src/common/primitive_cache.hpp"
 
 namespace {
@@ -116,6 +117,60 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+int get_dispatch_cache_size() {
+    int result = 0;
+    auto status = dnnl::impl::get_dispatch_cache_size(&result);
+    if (status != dnnl::impl::status::success) return -1;
+    return result;
+}
+
+std::vector<std::string> get_impl_names(const engine &eng, int mb) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto src_md = memory::desc({mb, 32}, dt::f32, tag::any);
+    auto wei_md = memory::desc({64, 32}, dt::f32, tag::any);
+    auto dst_md = memory::desc({mb, 64}, dt::f32, tag::any);
+    auto pd = inner_product_forward::primitive_desc(
+            eng, prop_kind::forward_inference, src_md, wei_md, dst_md);
+    std::vector<std::string> names;
+    do {
+        names.emplace_back(pd.impl_info_str());
+    } while (pd.next_impl());
+    return names;
+}
+
+TEST(dispatch_cache_test, TestCacheHit) {
+    ASSERT_EQ(dnnl::impl::set_dispatch_cache_capacity(0),
+            dnnl::impl::status::success);
+    ASSERT_EQ(dnnl::impl::set_dispatch_cache_capacity(256),
+            dnnl::impl::status::success);
+    ASSERT_EQ(get_dispatch_cache_size(), 0);
+
+    engine eng(get_test_engine_kind(), 0);
+    const auto names = get_impl_names(eng, 3);
+    // One entry per accepting implementation, except the reference ones.
+    int n_entries = 0;
+    for (const auto &name : names)
+        n_entries += name.find("ref") == std::string::npos;
+    ASSERT_EQ(get_dispatch_cache_size(), n_entries);
+
+    // Another size shares the signature and re-uses the entries.
+    const auto names_other_size = get_impl_names(eng, 5);
+    ASSERT_EQ(get_dispatch_cache_size(), n_entries);
+    ASSERT_EQ(names_other_size.front(), names.front());
+
+    // A unit size is a different signature.
+    get_impl_names(eng, 1);
+    if (n_entries > 0) {
+        ASSERT_GT(get_dispatch_cache_size(), n_entries);
+    }
+
+    ASSERT_EQ(dnnl::impl::set_dispatch_cache_capacity(0),
+            dnnl::impl::status::success);
+    ASSERT_EQ(get_dispatch_cache_size(), 0);
+}
 #endif
 
 } // namespace dnnl
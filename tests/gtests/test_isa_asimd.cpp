@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+#include "test_isa_pooling_common.hpp"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+namespace {
+
+// The max ISA can be set only once and before the first primitive creation,
+// so the whole test binary runs without SVE.
+bool limit_isa_to_asimd() {
+    static const bool ok = []() {
+        const auto isa = static_cast<dnnl_cpu_isa_t>(
+                impl::cpu::aarch64::dnnl_cpu_isa_asimd);
+        return dnnl_set_max_cpu_isa(isa) == dnnl_success
+                && dnnl_get_effective_cpu_isa() == isa;
+    }();
+    return ok;
+}
+
+} // namespace
+
+// The asimd kernel has no channel tail, so channels are a multiple of 4
+TEST(isa_asimd_test_t, TestPooling) {
+    SKIP_IF(!limit_isa_to_asimd(), "ASIMD is not available");
+    for_(auto fmt : {tag::nhwc, tag::nChw4c})
+    for (auto alg : {algorithm::pooling_max,
+                 algorithm::pooling_avg_include_padding,
+                 algorithm::pooling_avg_exclude_padding})
+        isa_pooling::test_pooling(alg, dt::f32, fmt, 12, "jit:asimd");
+}
+
+TEST(isa_asimd_test_t, TestPoolingBf16) {
+    SKIP_IF(!limit_isa_to_asimd(), "ASIMD is not available");
+    for (auto fmt : {tag::nhwc, tag::nChw4c})
+        isa_pooling::test_pooling(
+                algorithm::pooling_max, dt::bf16, fmt, 12, "jit:asimd");
+}
+
+TEST(isa_asimd_test_t, TestPoolingF16) {
+    SKIP_IF(!limit_isa_to_asimd(), "ASIMD is not available");
+    for (auto fmt : {tag::nhwc, tag::nChw4c})
+        isa_pooling::test_pooling(
+                algorithm::pooling_max, dt::f16, fmt, 12, "jit:asimd");
+}
+
+} // namespace dnnl
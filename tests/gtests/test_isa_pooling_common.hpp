@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef TEST_ISA_POOLING_COMMON_HPP
+#define TEST_ISA_POOLING_COMMON_HPP
+
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+template <typename pd_t>
+bool find_impl(pd_t &pd, const std::string &prefix) {
+    do {
+        if (std::string(pd.impl_info_str()).rfind(prefix, 0) == 0)
+            return true;
+    } while (pd.next_impl());
+    return false;
+}
+
+namespace isa_pooling {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// Small integers are exact in every data type and keep the sums exact.
+inline memory make_data(const memory::desc &md, int seed, engine &eng,
+        stream &s, bool is_unsigned) {
+    memory::desc f32_md(md.get_dims(), dt::f32, tag::nchw);
+    memory f32_mem(f32_md, eng), mem(md, eng);
+    float *ptr = static_cast<float *>(f32_mem.get_data_handle());
+    const size_t nelems = f32_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++) {
+        const int v = ((int)i * 7 + seed) % 11;
+        ptr[i] = static_cast<float>(is_unsigned ? v : v - 5);
+    }
+    reorder(f32_mem, mem).execute(s, f32_mem, mem);
+    s.wait();
+    return mem;
+}
+
+inline std::vector<float> to_f32(memory &mem, engine &eng, stream &s) {
+    memory::desc f32_md(mem.get_desc().get_dims(), dt::f32, tag::nchw);
+    memory f32_mem(f32_md, eng);
+    reorder(mem, f32_mem).execute(s, mem, f32_mem);
+    s.wait();
+    const float *ptr = static_cast<float *>(f32_mem.get_data_handle());
+    return std::vector<float>(ptr, ptr + f32_md.get_size() / sizeof(float));
+}
+
+// Checks forward pooling, and backward max pooling for non-integer data,
+// against a naive reference. The 3x3 windows with stride 2 overlap, so the
+// backward pass accumulates into diff_src.
+inline void test_pooling(algorithm alg, dt data_type, tag fmt, memory::dim c,
+        const std::string &impl_prefix) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    SKIP_IF(unsupported_data_type(data_type, eng),
+            "Engine does not support this data type.");
+
+    const memory::dim mb = 2, ih = 10, iw = 9, k = 3, st = 2, pad = 1;
+    const memory::dim oh = (ih + 2 * pad - k) / st + 1;
+    const memory::dim ow = (iw + 2 * pad - k) / st + 1;
+    const memory::dims strides {st, st}, kernel {k, k}, dilation {0, 0},
+            padding {pad, pad};
+    const bool is_int = data_type == dt::s8 || data_type == dt::u8;
+
+    memory::desc src_md({mb, c, ih, iw}, data_type, fmt);
+    memory::desc dst_md({mb, c, oh, ow}, data_type, fmt);
+    auto fwd_pd = pooling_forward::primitive_desc(eng,
+            is_int ? prop_kind::forward_inference
+                   : prop_kind::forward_training,
+            alg, src_md, dst_md, strides, kernel, dilation, padding, padding);
+    ASSERT_TRUE(find_impl(fwd_pd, impl_prefix)) << impl_prefix;
+
+    memory src = make_data(src_md, 1, eng, s, data_type == dt::u8);
+    memory dst(dst_md, eng);
+    memory ws(fwd_pd.workspace_desc(), eng);
+    pooling_forward(fwd_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_WORKSPACE, ws}});
+    s.wait();
+
+    const std::vector<float> src_f32 = to_f32(src, eng, s);
+    const std::vector<float> dst_f32 = to_f32(dst, eng, s);
+    // index of the first maximum of each window, used by the backward check
+    std::vector<memory::dim> argmax(dst_f32.size());
+    for_(memory::dim n = 0; n < mb * c; n++)
+    for_(memory::dim oy = 0; oy < oh; oy++)
+    for (memory::dim ox = 0; ox < ow; ox++) {
+        float max = 0.f, sum = 0.f;
+        memory::dim max_idx = -1, count = 0;
+        for_(memory::dim ky = 0; ky < k; ky++)
+        for (memory::dim kx = 0; kx < k; kx++) {
+            const memory::dim iy = oy * st - pad + ky, ix = ox * st - pad + kx;
+            if (iy < 0 || iy >= ih || ix < 0 || ix >= iw) continue;
+            const memory::dim idx = (n * ih + iy) * iw + ix;
+            if (max_idx < 0 || src_f32[idx] > max) {
+                max = src_f32[idx];
+                max_idx = idx;
+            }
+            sum += src_f32[idx];
+            count++;
+        }
+        const memory::dim dst_idx = (n * oh + oy) * ow + ox;
+        argmax[dst_idx] = max_idx;
+        if (alg == algorithm::pooling_max)
+            ASSERT_EQ(dst_f32[dst_idx], max);
+        else if (alg == algorithm::pooling_avg_include_padding)
+            ASSERT_EQ(dst_f32[dst_idx], sum / (k * k));
+        else
+            ASSERT_EQ(dst_f32[dst_idx], sum / count);
+    }
+
+    if (is_int || alg != algorithm::pooling_max) return;
+
+    // bf16 and f16 accumulate overlapping windows in the data type
+    primitive_attr attr;
+    if (data_type != dt::f32)
+        attr.set_accumulation_mode(accumulation_mode::relaxed);
+    auto bwd_pd = pooling_backward::primitive_desc(eng, alg, src_md, dst_md,
+            strides, kernel, dilation, padding, padding, fwd_pd, attr);
+    ASSERT_TRUE(find_impl(bwd_pd, impl_prefix)) << impl_prefix;
+
+    memory diff_dst = make_data(dst_md, 3, eng, s, false);
+    memory diff_src(src_md, eng);
+    pooling_backward(bwd_pd).execute(s,
+            {{DNNL_ARG_DIFF_DST, diff_dst}, {DNNL_ARG_DIFF_SRC, diff_src},
+                    {DNNL_ARG_WORKSPACE, ws}});
+    s.wait();
+
+    const std::vector<float> diff_dst_f32 = to_f32(diff_dst, eng, s);
+    const std::vector<float> diff_src_f32 = to_f32(diff_src, eng, s);
+    std::vector<float> ref(src_f32.size(), 0.f);
+    for (size_t i = 0; i < argmax.size(); i++)
+        ref[argmax[i]] += diff_dst_f32[i];
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_EQ(diff_src_f32[i], ref[i]);
+}
+
+} // namespace isa_pooling
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+#include "test_isa_pooling_common.hpp"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+namespace {
+
+// The max ISA can be set only once and before the first primitive creation,
+// so the whole test binary runs with SVE limited to 128 bits.
+bool limit_isa_to_sve_128() {
+    static const bool ok = []() {
+        const auto isa = static_cast<dnnl_cpu_isa_t>(
+                impl::cpu::aarch64::dnnl_cpu_isa_sve_128);
+        return dnnl_set_max_cpu_isa(isa) == dnnl_success
+                && dnnl_get_effective_cpu_isa() == isa;
+    }();
+    return ok;
+}
+
+// small integers keep all the sums exact in f32
+void fill(const memory &m, int seed) {
+    float *ptr = static_cast<float *>(m.get_data_handle());
+    const size_t nelems = m.get_desc().get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ptr[i] = static_cast<float>(((int)i * 7 + seed) % 11 - 5);
+}
+
+void test_conv(memory::dim g, memory::dim ic, memory::dim oc, memory::dim k,
+        memory::dim pad, const std::string &impl_prefix) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    const memory::dim mb = 2, ih = 9, iw = 11;
+    const memory::dim oh = ih + 2 * pad - k + 1;
+    const memory::dim ow = iw + 2 * pad - k + 1;
+    const bool with_groups = g > 1;
+    const memory::dims wei_dims = with_groups
+            ? memory::dims {g, oc, ic, k, k}
+            : memory::dims {oc, ic, k, k};
+
+    memory::desc src_md({mb, g * ic, ih, iw}, dt::f32, tag::nhwc);
+    memory::desc dst_md({mb, g * oc, oh, ow}, dt::f32, tag::nhwc);
+    memory::desc wei_user_md(
+            wei_dims, dt::f32, with_groups ? tag::goihw : tag::oihw);
+    memory::desc wei_any_md(wei_dims, dt::f32, tag::any);
+
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_any_md, dst_md, {1, 1}, {pad, pad}, {pad, pad});
+    ASSERT_TRUE(find_impl(pd, impl_prefix)) << impl_prefix;
+
+    memory src(src_md, eng), wei_user(wei_user_md, eng), dst(dst_md, eng);
+    fill(src, 1);
+    fill(wei_user, 2);
+
+    memory wei = wei_user;
+    if (pd.weights_desc() != wei_user_md) {
+        wei = memory(pd.weights_desc(), eng);
+        reorder(wei_user, wei).execute(s, wei_user, wei);
+    }
+    convolution_forward(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const float *src_ptr = static_cast<float *>(src.get_data_handle());
+    const float *wei_ptr = static_cast<float *>(wei_user.get_data_handle());
+    const float *dst_ptr = static_cast<float *>(dst.get_data_handle());
+    for_(memory::dim n = 0; n < mb; n++)
+    for_(memory::dim oy = 0; oy < oh; oy++)
+    for_(memory::dim ox = 0; ox < ow; ox++)
+    for_(memory::dim gg = 0; gg < g; gg++)
+    for (memory::dim o = 0; o < oc; o++) {
+        float acc = 0.f;
+        for_(memory::dim i = 0; i < ic; i++)
+        for_(memory::dim ky = 0; ky < k; ky++)
+        for (memory::dim kx = 0; kx < k; kx++) {
+            const memory::dim iy = oy - pad + ky, ix = ox - pad + kx;
+            if (iy < 0 || iy >= ih || ix < 0 || ix >= iw) continue;
+            acc += src_ptr[((n * ih + iy) * iw + ix) * g * ic + gg * ic + i]
+                    * wei_ptr[(((gg * oc + o) * ic + i) * k + ky) * k + kx];
+        }
+        const auto dst_off = ((n * oh + oy) * ow + ox) * g * oc + gg * oc + o;
+        ASSERT_EQ(dst_ptr[dst_off], acc);
+    }
+}
+
+} // namespace
+
+TEST(isa_sve_128_test_t, TestBrgemmMatmul) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    // N is not a multiple of the 4-float vector to exercise the tails
+    const memory::dim M = 13, K = 37, N = 35;
+    memory::desc a_md({M, K}, dt::f32, tag::ab);
+    memory::desc b_md({K, N}, dt::f32, tag::ab);
+    memory::desc c_md({M, N}, dt::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, a_md, b_md, c_md);
+    ASSERT_TRUE(find_impl(pd, "brg:sve_128"));
+
+    memory a(a_md, eng), b(b_md, eng), c(c_md, eng);
+    fill(a, 1);
+    fill(b, 2);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_WEIGHTS, b}, {DNNL_ARG_DST, c}});
+    s.wait();
+
+    const float *a_ptr = static_cast<float *>(a.get_data_handle());
+    const float *b_ptr = static_cast<float *>(b.get_data_handle());
+    const float *c_ptr = static_cast<float *>(c.get_data_handle());
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float acc = 0.f;
+        for (memory::dim kk = 0; kk < K; kk++)
+            acc += a_ptr[m * K + kk] * b_ptr[kk * N + n];
+        ASSERT_EQ(c_ptr[m * N + n], acc);
+    }
+}
+
+TEST(isa_sve_128_test_t, TestBrgemmConv) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    test_conv(1, 8, 20, 3, 1, "brgconv:sve_128");
+}
+
+TEST(isa_sve_128_test_t, TestBrgemm1x1Conv) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    test_conv(1, 16, 36, 1, 0, "brgconv_1x1:sve_128");
+}
+
+TEST(isa_sve_128_test_t, TestBrdgmmDwConv) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    test_conv(20, 1, 1, 3, 1, "brdgmm_dw:sve_128");
+}
+
+// 13 channels leave a tail in the 4-channel blocks
+TEST(isa_sve_128_test_t, TestPooling) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    for_(auto fmt : {tag::nhwc, tag::nChw4c})
+    for (auto alg : {algorithm::pooling_max,
+                 algorithm::pooling_avg_include_padding,
+                 algorithm::pooling_avg_exclude_padding})
+        isa_pooling::test_pooling(alg, dt::f32, fmt, 13, "jit:sve_128");
+}
+
+TEST(isa_sve_128_test_t, TestPoolingBf16) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    for (auto fmt : {tag::nhwc, tag::nChw4c})
+        isa_pooling::test_pooling(
+                algorithm::pooling_max, dt::bf16, fmt, 13, "jit:sve_128");
+}
+
+TEST(isa_sve_128_test_t, TestPoolingF16) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    for (auto fmt : {tag::nhwc, tag::nChw4c})
+        isa_pooling::test_pooling(
+                algorithm::pooling_max, dt::f16, fmt, 13, "jit:sve_128");
+}
+
+TEST(isa_sve_128_test_t, TestPoolingInt8) {
+    SKIP_IF(!limit_isa_to_sve_128(), "SVE 128 is not available");
+    for (auto data_type : {dt::s8, dt::u8})
+        isa_pooling::test_pooling(algorithm::pooling_max, data_type,
+                tag::nhwc, 13, "jit_int:sve_128");
+}
+
+} // namespace dnnl
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// Runs a sequence in one call and then time step by time step with the
+// recurrent state updated in place, both runs must produce the same results.
+class rnn_streaming_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng_ = engine(engine::kind::cpu, 0);
+        strm_ = stream(eng_);
+    }
+
+    static constexpr memory::dim L = 2, D = 1, T = 4, N = 2, C = 16;
+
+    static memory::desc layer_md(memory::dim t) {
+        return {{t, N, C}, dt::f32, tag::tnc};
+    }
+    static memory::desc state_md() {
+        return {{L, D, N, C}, dt::f32, tag::ldnc};
+    }
+    static memory::desc weights_md(memory::dim G, tag t) {
+        return {{L, D, C, G, C}, dt::f32, t};
+    }
+    static memory::desc bias_md(memory::dim G) {
+        return {{L, D, G, C}, dt::f32, tag::ldgo};
+    }
+
+    static void fill(const memory &m, int seed, float scale) {
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t nelems = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = scale * (((int)i * 37 + seed) % 101 / 101.f - 0.5f);
+    }
+
+    static void copy(const memory &dst, const memory &src, size_t src_off) {
+        std::memcpy(dst.get_data_handle(),
+                static_cast<char *>(src.get_data_handle()) + src_off,
+                dst.get_desc().get_size());
+    }
+
+    static void compare(const memory &got, const memory &ref, size_t ref_off) {
+        const float *got_ptr = static_cast<float *>(got.get_data_handle());
+        const float *ref_ptr = reinterpret_cast<const float *>(
+                static_cast<char *>(ref.get_data_handle()) + ref_off);
+        const size_t nelems = got.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_NEAR(got_ptr[i], ref_ptr[i],
+                    1e-5f * std::max(1.f, std::fabs(ref_ptr[i])));
+    }
+
+    memory reorder_to(memory user, const memory::desc &md) {
+        if (user.get_desc() == md) return user;
+        memory m(md, eng_);
+        reorder(user, m).execute(strm_, user, m);
+        strm_.wait();
+        return m;
+    }
+
+    // `make_pd` creates a primitive descriptor for `t` time steps with
+    // weights in format `any`.
+    template <typename prim_t>
+    void run(memory::dim G, bool with_c,
+            const std::function<typename prim_t::primitive_desc(memory::dim)>
+                    &make_pd) {
+        const auto full_pd = make_pd(T);
+        const auto step_pd = make_pd(1);
+
+        memory src_layer(layer_md(T), eng_), src_iter(state_md(), eng_),
+                src_iter_c(state_md(), eng_),
+                wei_layer(weights_md(G, tag::ldigo), eng_),
+                wei_iter(weights_md(G, tag::ldigo), eng_),
+                bias(bias_md(G), eng_);
+        fill(src_layer, 1, 1.f);
+        fill(src_iter, 2, 1.f);
+        fill(src_iter_c, 3, 1.f);
+        fill(wei_layer, 4, 0.5f);
+        fill(wei_iter, 5, 0.5f);
+        fill(bias, 6, 0.5f);
+
+        memory dst_layer(layer_md(T), eng_), dst_iter(state_md(), eng_),
+                dst_iter_c(state_md(), eng_);
+        std::unordered_map<int, memory> args
+                = {{DNNL_ARG_SRC_LAYER, src_layer},
+                        {DNNL_ARG_SRC_ITER, src_iter},
+                        {DNNL_ARG_WEIGHTS_LAYER,
+                                reorder_to(wei_layer,
+                                        full_pd.weights_layer_desc())},
+                        {DNNL_ARG_WEIGHTS_ITER,
+                                reorder_to(
+                                        wei_iter, full_pd.weights_iter_desc())},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_layer},
+                        {DNNL_ARG_DST_ITER, dst_iter}};
+        if (with_c) {
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+        prim_t(full_pd).execute(strm_, args);
+        strm_.wait();
+
+        // The state lives in `h` and `c` across the calls, the weights are
+        // reordered once.
+        memory h(state_md(), eng_), c(state_md(), eng_);
+        copy(h, src_iter, 0);
+        copy(c, src_iter_c, 0);
+        memory src_t(layer_md(1), eng_), dst_t(layer_md(1), eng_);
+        args = {{DNNL_ARG_SRC_LAYER, src_t}, {DNNL_ARG_SRC_ITER, h},
+                {DNNL_ARG_WEIGHTS_LAYER,
+                        reorder_to(wei_layer, step_pd.weights_layer_desc())},
+                {DNNL_ARG_WEIGHTS_ITER,
+                        reorder_to(wei_iter, step_pd.weights_iter_desc())},
+                {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_t},
+                {DNNL_ARG_DST_ITER, h}};
+        if (with_c) {
+            args.insert({DNNL_ARG_SRC_ITER_C, c});
+            args.insert({DNNL_ARG_DST_ITER_C, c});
+        }
+        const prim_t step(step_pd);
+        const size_t step_size = layer_md(1).get_size();
+        for (memory::dim t = 0; t < T; t++) {
+            copy(src_t, src_layer, t * step_size);
+            step.execute(strm_, args);
+            strm_.wait();
+            compare(dst_t, dst_layer, t * step_size);
+        }
+        compare(h, dst_iter, 0);
+        if (with_c) compare(c, dst_iter_c, 0);
+    }
+
+    engine eng_;
+    stream strm_;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(rnn_streaming_test_t, TestLSTM) {
+    const memory::dim G = 4;
+    run<lstm_forward>(G, true, [&](memory::dim t) {
+        return lstm_forward::primitive_desc(eng_, prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, layer_md(t),
+                state_md(), state_md(), weights_md(G, tag::any),
+                weights_md(G, tag::any), bias_md(G), layer_md(t), state_md(),
+                state_md());
+    });
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(rnn_streaming_test_t, TestGRU) {
+    const memory::dim G = 3;
+    run<gru_forward>(G, false, [&](memory::dim t) {
+        return gru_forward::primitive_desc(eng_, prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, layer_md(t),
+                state_md(), weights_md(G, tag::any), weights_md(G, tag::any),
+                bias_md(G), layer_md(t), state_md());
+    });
+}
+
+} // namespace dnnl
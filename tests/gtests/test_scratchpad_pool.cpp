@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2025 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace {
+void custom_setenv(const char *name, const char *value) {
+#ifdef _WIN32
+    _putenv((std::string(name) + "=" + value).c_str());
+#else
+    ::setenv(name, value, 1);
+#endif
+}
+} // namespace
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+// The pool has to be enabled before the first primitive is created, hence the
+// test lives in a separate executable.
+HANDLE_EXCEPTIONS_FOR_TEST(scratchpad_pool_test_t, TestStreamPool) {
+    // Asynchronous runtimes may still use the buffer after the primitive
+    // returns, so the pool is disabled for them.
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL,
+            "the scratchpad pool is not supported by the CPU runtime");
+    custom_setenv("ONEDNN_SCRATCHPAD_POOL", "1");
+
+    engine eng(engine::kind::cpu, 0);
+
+    const memory::dims src_dims = {2, 64, 28, 28};
+    const memory::dims wei_dims = {64, 64, 3, 3};
+    const memory::dims dst_dims = {2, 64, 28, 28};
+    memory::desc src_md(src_dims, dt::f32, tag::any);
+    memory::desc wei_md(wei_dims, dt::f32, tag::any);
+    memory::desc dst_md(dst_dims, dt::f32, tag::any);
+
+    primitive_attr user_attr;
+    user_attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto user_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, user_attr);
+    const size_t scratchpad_size = user_pd.scratchpad_desc().get_size();
+    if (scratchpad_size == 0) {
+        GTEST_SKIP() << "the implementation does not need a scratchpad";
+    }
+
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1});
+    auto src = test::make_memory(pd.src_desc(), eng);
+    auto wei = test::make_memory(pd.weights_desc(), eng);
+    auto dst = test::make_memory(pd.dst_desc(), eng);
+
+    // Two primitives with the same scratchpad size share a single buffer.
+    convolution_forward conv0(pd), conv1(pd);
+    stream s(eng);
+    for (int i = 0; i < 2; i++) {
+        for (auto *conv : {&conv0, &conv1})
+            conv->execute(s,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst}});
+        s.wait();
+    }
+
+    auto stats = get_scratchpad_pool_stats(s);
+    SKIP_IF(stats.misses + stats.hits == 0,
+            "the scratchpad pool is not active for the stream");
+    ASSERT_EQ(stats.misses, 1u);
+    ASSERT_EQ(stats.hits, 3u);
+    ASSERT_EQ(stats.in_use, 0u);
+    ASSERT_GE(stats.capacity, scratchpad_size);
+    ASSERT_EQ(stats.peak_in_use, stats.capacity);
+    ASSERT_EQ(stats.limit, 0u);
+
+    // A limit below the cached size releases the cached buffers.
+    set_scratchpad_pool_limit(s, 1);
+    stats = get_scratchpad_pool_stats(s);
+    ASSERT_EQ(stats.capacity, 0u);
+    ASSERT_EQ(stats.limit, 1u);
+
+    // A buffer above the limit is kept while in use and released after.
+    conv0.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    s.wait();
+    stats = get_scratchpad_pool_stats(s);
+    ASSERT_EQ(stats.misses, 2u);
+    ASSERT_EQ(stats.capacity, 0u);
+
+    // Streams have independent pools.
+    stream s2(eng);
+    ASSERT_EQ(get_scratchpad_pool_stats(s2).capacity, 0u);
+}
+
+} // namespace dnnl